@@ -63,7 +63,8 @@ b2BlockAllocator::b2BlockAllocator()
 	memset(m_chunks, 0, m_chunkSpace * sizeof(b2Chunk));
 	memset(m_freeLists, 0, sizeof(m_freeLists));
 
-	if (s_blockSizeLookupInitialized == false)
+	// Function-local statics are initialized exactly once, even with several threads
+	static const bool lookupInitialized = []()
 	{
 		int32 j = 0;
 		for (int32 i = 1; i <= b2_maxBlockSize; ++i)
@@ -81,7 +82,9 @@ b2BlockAllocator::b2BlockAllocator()
 		}
 
 		s_blockSizeLookupInitialized = true;
-	}
+		return true;
+	}();
+	B2_NOT_USED(lookupInitialized);
 }
 
 b2BlockAllocator::~b2BlockAllocator()
@@ -0,0 +1,32 @@
+/**
+ * @file contactevents.cpp
+ * @brief Implementation of the ContactEventBuffer class
+ *
+ * @author Team AJKJ
+ */
+
+#include "contactevents.h"
+
+ContactEventBuffer::ContactEventBuffer(const HazardStore *hazards, size_t capacity) : m_hazards(hazards) {
+    m_events.reserve(capacity);
+}
+
+void ContactEventBuffer::beginContact(b2Contact *contact)
+{
+    record(contact, ContactEvent::Begin);
+}
+
+void ContactEventBuffer::EndContact(b2Contact *contact)
+{
+    record(contact, ContactEvent::End);
+}
+
+void ContactEventBuffer::record(b2Contact *contact, ContactEvent::Type type)
+{
+    // Reading the hazard tag from user data is all the work done inside the step
+    HazardHandle handle;
+    if (m_hazards->handleOf(contact->GetFixtureA()->GetBody(), handle) ||
+        m_hazards->handleOf(contact->GetFixtureB()->GetBody(), handle)) {
+        m_events.push_back({handle, type});
+    }
+}
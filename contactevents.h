@@ -0,0 +1,88 @@
+/**
+ * @file contactevents.h
+ * @brief Defines the ContactEvent records Box2D contacts are buffered as during a step,
+ *        the ContactEventBuffer that collects them and the ContactHandler that consumes them
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef CONTACTEVENTS_H
+#define CONTACTEVENTS_H
+
+#include "hazardstore.h"
+#include <box2d/box2d.h>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief A hazard's sensor starting or stopping to touch another body
+ */
+struct ContactEvent {
+    enum Type : uint8_t {
+        Begin,
+        End
+    };
+
+    HazardHandle hazard;    // Hazard whose sensor was touched
+    Type type;
+};
+
+/**
+ * @brief The world's Box2D contact listener. It runs inside b2World::Step, so all it does
+ * is append a ContactEvent for every contact involving a hazard; game logic reads them
+ * once the step is over.
+ */
+class ContactEventBuffer : public b2ContactListener {
+
+private:
+
+    const HazardStore *m_hazards;           // Resolves bodies to hazards; not owned
+    std::vector<ContactEvent> m_events;     // Events since the last clear(), in the order Box2D reported them
+
+    /**
+     * @brief Appends an event if either body of the contact is a hazard
+     */
+    void record(b2Contact *contact, ContactEvent::Type type);
+
+public:
+
+    /**
+     * @brief Constructor
+     * @param hazards Hazards of the world the buffer listens to
+     * @param capacity Events to make room for up front, so a step does not allocate
+     */
+    ContactEventBuffer(const HazardStore *hazards, size_t capacity);
+
+    void beginContact(b2Contact *contact) override;
+
+    void EndContact(b2Contact *contact) override;
+
+    /**
+     * @brief Events recorded since the last clear()
+     */
+    const std::vector<ContactEvent> &events() const { return m_events; }
+
+    /**
+     * @brief Forgets the recorded events, keeping the buffer's capacity
+     */
+    void clear() { m_events.clear(); }
+};
+
+/**
+ * @brief Game logic stage that reacts to a step's contacts after b2World::Step has returned
+ */
+class ContactHandler {
+
+public:
+
+    virtual ~ContactHandler() = default;
+
+    /**
+     * @brief Handles the contacts of one step. The world may be changed from here, for
+     *        example by queueing hazards for removal.
+     * @param events The step's events, in the order Box2D reported them
+     */
+    virtual void handleContacts(const std::vector<ContactEvent> &events) = 0;
+};
+
+#endif // CONTACTEVENTS_H
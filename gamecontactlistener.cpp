@@ -9,39 +9,36 @@
 #include "gameContactListener.h"
 #include <cstring>
 #include "physicsworld.h"
-#include <QDebug>
 
 GameContactListener::GameContactListener(GameManager *gameManager, PhysicsWorld *physicsWorld)
-    : m_gameManager(gameManager), m_physicsWorld(physicsWorld), m_processedBodies(){ }
+    : m_gameManager(gameManager), m_physicsWorld(physicsWorld), m_processedHazards(){ }
 
-void GameContactListener::beginContact(b2Contact* contact) {
-    b2Body *bodyA = contact->GetFixtureA()->GetBody();
-    b2Body *bodyB = contact->GetFixtureB()->GetBody();
+void GameContactListener::handleContacts(const std::vector<ContactEvent> &events) {
+    const HazardStore &hazards = m_physicsWorld->getHazards();
 
-    Hazard* hazard = nullptr;
-    b2Body* hazardBody = nullptr;
+    for (const ContactEvent &event : events) {
+        // Only the first touch matters; a hazard is gone before it could be left again
+        int index = hazards.indexOf(event.hazard);
+        if (event.type != ContactEvent::Begin || index < 0) {
+            continue;
+        }
 
-    // Check if either body is a hazard
-    if (bodyA->GetUserData()) {
-        hazard = static_cast<Hazard*>(bodyA->GetUserData());
-        hazardBody = bodyA;
-    }
-    else if (bodyB->GetUserData()) {
-        hazard = static_cast<Hazard*>(bodyB->GetUserData());
-        hazardBody = bodyB;
-    }
-
-    // Process hazard if it exists and hasen't been processed yet
-    if (hazard && m_processedBodies.find(hazardBody) == m_processedBodies.end()) {
+        // Process hazard if it hasen't been processed yet, marking it to prevent duplicate
+        // processing. Handles are never reused, so a recycled body is a new hazard.
+        if (m_processedHazards.insert(event.hazard)) {
 
-        // Mark this body as processed to prevent duplicate processing
-        m_processedBodies.insert(hazardBody);
+            // Look up the plant before the hazard is queued for removal
+            int plantId = hazards.plantIds()[index];
 
-        // Queue the hazard for removal
-        m_physicsWorld->queueForRemoval(hazard->getBody());
+            // Queue the hazard for removal
+            m_physicsWorld->queueForRemoval(event.hazard);
 
-        // Emit the signal to show popup
-        qDebug() << "About to emit!";
-        emit plantContact(hazard);
+            // Emit the signal to show popup
+            emit plantContact(plantId);
+        }
     }
 }
+
+void GameContactListener::reset() {
+    m_processedHazards.clear();
+}
@@ -12,17 +12,17 @@
 
 #include <QObject>
 #include <box2d/box2d.h>
-#include <unordered_set>
+#include "contactevents.h"
 #include "gameManager.h"
-#include "hazard.h"
 
 // Forward declaration
 class PhysicsWorld;
 
 /**
  * @brief handles Box2D collision contact events and connect them to game logic.
+ *        The events arrive after each physics step, never from inside b2World::Step.
  */
-class GameContactListener : public QObject, public b2ContactListener {
+class GameContactListener : public QObject, public ContactHandler {
     Q_OBJECT
 
 private:
@@ -31,15 +31,15 @@ private:
 
     PhysicsWorld *m_physicsWorld;
 
-    std::unordered_set<b2Body*> m_processedBodies;
+    HazardHandleSet m_processedHazards;     // Hazards already handled, so each pops up once
 
 signals:
 
     /**
      * @brief Function to handle contact event. Signal emitted when contact with a plant occurs.
-     * @param hazard pointer to the hazard that was contacted.
+     * @param plantId plant catalog ID of the hazard that was contacted.
      */
-    void plantContact(Hazard *hazard);
+    void plantContact(int plantId);
 
 public:
 
@@ -51,10 +51,17 @@ public:
     GameContactListener(GameManager *gameManager, PhysicsWorld *physicsWorld);
 
     /**
-     * @brief Called when vehicle and plant object begin to touch.
-     * @param contact Pointer to the contact object.
+     * @brief Called after each physics step with the contacts the step reported. Queues
+     *        every newly touched plant for removal and emits plantContact for it.
+     * @param events The step's contact events.
      */
-    virtual void beginContact(b2Contact* contact) override;
+    virtual void handleContacts(const std::vector<ContactEvent> &events) override;
+
+    /**
+     * @brief Forgets which hazards have been touched. A new or restarted level's hazards
+     *        get fresh handles that never match the old ones, so this only drops stale entries.
+     */
+    void reset();
 };
 
 #endif // GAMECONTACTLISTENER_H
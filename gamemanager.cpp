@@ -7,6 +7,7 @@
  */
 
 #include "gameManager.h"
+#include "plantcatalog.h"
 
 GameManager::GameManager(QObject *parent): QObject(parent),
                                             m_gameState(MainMenu),
@@ -150,3 +151,43 @@ bool GameManager::isLevelComplete() const {
     }
     return true; // All plants collected
 }
+
+void GameManager::saveProgress(SavedProgress &progress) const {
+    progress.gameState = m_gameState;
+    progress.level = m_currentLevel;
+    progress.score = m_score;
+    progress.health = m_health;
+    progress.poisonousCollected = m_poisonousCollected;
+
+    // Plants are saved by catalog ID rather than by name
+    const PlantCatalog &catalog = PlantCatalog::instance();
+    progress.trackedPlantCount = 0;
+    for (const auto& pair : m_plantsToCollect) {
+        int plantId = catalog.idOf(pair.first);
+        if (plantId < 0 || progress.trackedPlantCount == SavedProgress::MaxTrackedPlants) {
+            continue;
+        }
+        progress.trackedPlants[progress.trackedPlantCount++] = {plantId, pair.second.collected, pair.second.total};
+    }
+}
+
+void GameManager::restoreProgress(const SavedProgress &progress) {
+    m_currentLevel = progress.level;
+    m_score = progress.score;
+    m_health = progress.health;
+    m_poisonousCollected = progress.poisonousCollected;
+
+    const PlantCatalog &catalog = PlantCatalog::instance();
+    m_plantsToCollect.clear();
+    for (int i = 0; i < progress.trackedPlantCount; ++i) {
+        const SavedPlantProgress &plant = progress.trackedPlants[i];
+        if (plant.plantId >= 0 && plant.plantId < catalog.size()) {
+            m_plantsToCollect[catalog.plant(plant.plantId).name] = {plant.collected, plant.total};
+        }
+    }
+
+    // Anything unexpected falls back to the first level
+    bool validState = progress.gameState >= MainMenu && progress.gameState <= GameClear;
+    m_gameState = validState ? static_cast<GameState>(progress.gameState) : Level1;
+    emit stateChanged(m_gameState);
+}
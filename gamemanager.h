@@ -10,6 +10,7 @@
 #define GAMEMANAGER_H
 
 #include <QObject>
+#include "savestate.h"
 
 /**
  * @brief Enumeration for the various states of the game.
@@ -30,6 +31,10 @@ enum GameState {
 class GameManager : public QObject {
     Q_OBJECT
 
+public:
+
+    static const int LevelCount = 3;   // Levels the game is made of
+
 private:
 
     GameState m_gameState; // Current state of the game
@@ -48,7 +53,7 @@ private:
     std::map<QString, plantTracking> m_plantsToCollect; // Tracks plants to collect by name
     int m_poisonousCollected = 0;                       // Count of poisonous plants collected
     int m_maxPoisonousAllowed = 3;                      // Maximum poisonous plants allowed
-    QStringList m_levelPlants[3];                       // Plants for each level
+    QStringList m_levelPlants[LevelCount];              // Plants for each level
 
 public:
 
@@ -168,6 +173,18 @@ public:
      */
     const std::map<QString, plantTracking>& plantsToCollect() const { return m_plantsToCollect; }
 
+    /**
+     * @brief Record the current progress for a save-state.
+     * @param progress Receives the state, level, counters and plant collection progress.
+     */
+    void saveProgress(SavedProgress &progress) const;
+
+    /**
+     * @brief Restore progress from a save-state and announce the restored state.
+     * @param progress Progress previously recorded by saveProgress.
+     */
+    void restoreProgress(const SavedProgress &progress);
+
 public slots:
 
     /**
@@ -0,0 +1,102 @@
+/**
+ * @file hazardplacer.cpp
+ * @brief Implementation of the HazardPlacer class
+ *
+ * @author Team AJKJ
+ */
+
+#include "hazardplacer.h"
+#include <algorithm>
+#include <cmath>
+
+HazardPlacer::HazardPlacer(const TerrainProfile &profile, float maxSlope) : m_profile(profile),
+                                                                            m_maxSlope(maxSlope) { }
+
+std::vector<HazardPlacer::Interval> HazardPlacer::allowedIntervals(float startX, float endX) const
+{
+    std::vector<Interval> intervals;
+    if (endX <= startX) {
+        return intervals;
+    }
+
+    // Walk the segments under the range once, merging neighbouring allowed segments
+    int firstSegment = m_profile.segmentIndexAt(startX);
+    int lastSegment = m_profile.segmentIndexAt(endX);
+    for (int segment = firstSegment; segment <= lastSegment; ++segment) {
+        float segmentStart = std::max(startX, m_profile.vertexX(segment));
+        float segmentEnd = std::min(endX, m_profile.vertexX(segment + 1));
+        if (segmentEnd <= segmentStart || m_profile.slopeAt(segmentStart) > m_maxSlope) {
+            continue;
+        }
+
+        if (!intervals.empty() && intervals.back().endX >= segmentStart) {
+            intervals.back().endX = segmentEnd;
+        } else {
+            intervals.push_back({segmentStart, segmentEnd});
+        }
+    }
+    return intervals;
+}
+
+float HazardPlacer::allowedLength(float startX, float endX) const
+{
+    float length = 0.0f;
+    for (const Interval &interval : allowedIntervals(startX, endX)) {
+        length += interval.endX - interval.startX;
+    }
+    return length;
+}
+
+PlacementResult HazardPlacer::place(int count, float startX, float endX, float minSpacing, RandomGenerator &random) const
+{
+    PlacementResult result;
+    std::vector<Interval> intervals = allowedIntervals(startX, endX);
+
+    double usableLength = 0.0;
+    for (const Interval &interval : intervals) {
+        usableLength += interval.endX - interval.startX;
+    }
+
+    // Only as many hazards as fit at the minimum spacing can be placed
+    int placeable = std::max(count, 0);
+    if (usableLength <= 0.0) {
+        placeable = 0;
+    } else if (minSpacing > 0.0f) {
+        placeable = std::min(placeable, static_cast<int>(usableLength / minSpacing) + 1);
+    }
+    result.unplacedCount = std::max(count, 0) - placeable;
+    if (placeable == 0) {
+        return result;
+    }
+
+    // Sorted uniform offsets over the slack, generated in order from the normalised running
+    // sum of exponential gaps so no sort is needed
+    double slack = std::max(0.0, usableLength - (placeable - 1) * static_cast<double>(minSpacing));
+    std::vector<double> offsets(placeable);
+    double runningSum = 0.0;
+    for (int i = 0; i < placeable; ++i) {
+        runningSum += -std::log(random.nextDouble());
+        offsets[i] = runningSum;
+    }
+    runningSum += -std::log(random.nextDouble());
+
+    // Add the reserved spacing back and map each usable-length coordinate onto the road
+    result.positions.reserve(placeable);
+    size_t intervalIndex = 0;
+    double intervalStart = 0.0; // Usable-length coordinate where the current interval begins
+    for (int i = 0; i < placeable; ++i) {
+        double coordinate = offsets[i] / runningSum * slack + i * static_cast<double>(minSpacing);
+
+        while (intervalIndex + 1 < intervals.size() &&
+               coordinate > intervalStart + (intervals[intervalIndex].endX - intervals[intervalIndex].startX)) {
+            intervalStart += intervals[intervalIndex].endX - intervals[intervalIndex].startX;
+            intervalIndex++;
+        }
+
+        const Interval &interval = intervals[intervalIndex];
+        float position = interval.startX + static_cast<float>(coordinate - intervalStart);
+        result.positions.push_back(std::min(position, interval.endX));
+    }
+
+    return result;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file hazardplacer.h
+ * @brief Defines the HazardPlacer class that scatters hazards along the road
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef HAZARDPLACER_H
+#define HAZARDPLACER_H
+
+#include "randomgenerator.h"
+#include "terrainprofile.h"
+#include <vector>
+
+/**
+ * @brief Result of a placement run
+ */
+struct PlacementResult {
+    std::vector<float> positions;   // X coordinates of placed hazards, ascending
+    int unplacedCount = 0;          // Hazards that could not be placed under the constraints
+};
+
+/**
+ * @brief Scatters hazards along the road with one-dimensional Poisson-disk sampling.
+ *
+ * Only road segments whose slope is allowed are usable, so the placer first collapses
+ * them into one continuous "usable length". It then draws sorted uniform offsets over
+ * the slack left after reserving the minimum spacing between every pair of neighbours,
+ * adds the reserved spacing back, and maps the result onto the road. Every layout that
+ * honours the spacing is equally likely, no hazard is ever checked against another,
+ * and the whole run is linear in hazards plus road segments.
+ */
+class HazardPlacer {
+
+private:
+
+    /**
+     * @brief A stretch of road hazards may sit on
+     */
+    struct Interval {
+        float startX;
+        float endX;
+    };
+
+    const TerrainProfile &m_profile;    // Road the hazards are placed on
+    float m_maxSlope;                   // Steepest uphill slope (dy/dx) a hazard may sit on
+
+    /**
+     * @brief Collects the stretches of [startX, endX] whose slope is allowed, merging neighbours
+     */
+    std::vector<Interval> allowedIntervals(float startX, float endX) const;
+
+public:
+
+    /**
+     * @brief Constructor
+     * @param profile Road the hazards are placed on
+     * @param maxSlope Steepest uphill slope a hazard may sit on (0 = flat or downhill only)
+     */
+    explicit HazardPlacer(const TerrainProfile &profile, float maxSlope = 0.0f);
+
+    /**
+     * @brief Total length of [startX, endX] that hazards may sit on
+     * @param startX Left end of the range
+     * @param endX Right end of the range
+     * @return Usable length in meters
+     */
+    float allowedLength(float startX, float endX) const;
+
+    /**
+     * @brief Picks hazard x positions
+     * @param count Number of hazards wanted
+     * @param startX Left end of the placement range
+     * @param endX Right end of the placement range
+     * @param minSpacing Minimum distance between neighbouring hazards
+     * @param random Generator the layout is drawn from
+     * @return Placed positions and the number of hazards that did not fit
+     */
+    PlacementResult place(int count, float startX, float endX, float minSpacing, RandomGenerator &random) const;
+};
+
+#endif // HAZARDPLACER_H
@@ -0,0 +1,147 @@
+/**
+ * @file hazardstore.cpp
+ * @brief Implementation of the HazardStore slot map
+ *
+ * @author Team AJKJ
+ */
+
+#include "hazardstore.h"
+
+HazardHandle HazardStore::insert(b2Body *body, const b2Vec2 &position, float radius, PlantKind kind, int plantId)
+{
+    // Reuse a freed slot if there is one, otherwise grow the slot table
+    uint32_t slotIndex;
+    if (!m_freeSlots.empty()) {
+        slotIndex = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        slotIndex = static_cast<uint32_t>(m_slots.size());
+        m_slots.push_back({0, 0});
+    }
+
+    Slot &slot = m_slots[slotIndex];
+    slot.denseIndex = static_cast<uint32_t>(m_bodies.size());
+    m_bodies.push_back(body);
+    m_positions.push_back(position);
+    m_radii.push_back(radius);
+    m_kinds.push_back(kind);
+    m_plantIds.push_back(plantId);
+    m_denseToSlot.push_back(slotIndex);
+    m_version++;
+
+    // Tag the body so contact callbacks can find the hazard
+    body->SetUserData(reinterpret_cast<void*>(static_cast<uintptr_t>(slotIndex) + 1));
+
+    return HazardHandle{slotIndex, slot.generation};
+}
+
+int HazardStore::indexOf(HazardHandle handle) const
+{
+    if (handle.index >= m_slots.size() || m_slots[handle.index].generation != handle.generation) {
+        return -1;
+    }
+    return static_cast<int>(m_slots[handle.index].denseIndex);
+}
+
+bool HazardStore::handleOf(const b2Body *body, HazardHandle &handle) const
+{
+    uintptr_t tag = reinterpret_cast<uintptr_t>(body->GetUserData());
+    if (tag == 0 || tag > m_slots.size()) {
+        return false;
+    }
+
+    // Only bodies currently in the store carry a tag, so the slot's generation is current
+    handle.index = static_cast<uint32_t>(tag - 1);
+    handle.generation = m_slots[handle.index].generation;
+    return true;
+}
+
+b2Body *HazardStore::remove(HazardHandle handle)
+{
+    int index = indexOf(handle);
+    if (index < 0) {
+        return nullptr;
+    }
+
+    uint32_t denseIndex = static_cast<uint32_t>(index);
+    uint32_t lastIndex = static_cast<uint32_t>(m_bodies.size() - 1);
+    b2Body *body = m_bodies[denseIndex];
+
+    // Move the last hazard into the hole and repoint its slot
+    if (denseIndex != lastIndex) {
+        m_bodies[denseIndex] = m_bodies[lastIndex];
+        m_positions[denseIndex] = m_positions[lastIndex];
+        m_radii[denseIndex] = m_radii[lastIndex];
+        m_kinds[denseIndex] = m_kinds[lastIndex];
+        m_plantIds[denseIndex] = m_plantIds[lastIndex];
+        m_denseToSlot[denseIndex] = m_denseToSlot[lastIndex];
+        m_slots[m_denseToSlot[denseIndex]].denseIndex = denseIndex;
+    }
+    m_bodies.pop_back();
+    m_positions.pop_back();
+    m_radii.pop_back();
+    m_kinds.pop_back();
+    m_plantIds.pop_back();
+    m_denseToSlot.pop_back();
+
+    // Invalidate outstanding handles and recycle the slot
+    m_slots[handle.index].generation++;
+    m_freeSlots.push_back(handle.index);
+    m_version++;
+
+    body->SetUserData(nullptr);
+    return body;
+}
+
+void HazardStore::clear()
+{
+    for (size_t denseIndex = 0; denseIndex < m_bodies.size(); ++denseIndex) {
+        uint32_t slotIndex = m_denseToSlot[denseIndex];
+        m_slots[slotIndex].generation++;
+        m_freeSlots.push_back(slotIndex);
+        m_bodies[denseIndex]->SetUserData(nullptr);
+    }
+    m_bodies.clear();
+    m_positions.clear();
+    m_radii.clear();
+    m_kinds.clear();
+    m_plantIds.clear();
+    m_denseToSlot.clear();
+    m_version++;
+}
+
+void HazardStore::reserve(size_t count)
+{
+    m_bodies.reserve(count);
+    m_positions.reserve(count);
+    m_radii.reserve(count);
+    m_kinds.reserve(count);
+    m_plantIds.reserve(count);
+    m_denseToSlot.reserve(count);
+    m_slots.reserve(count);
+    m_freeSlots.reserve(count);
+}
+
+HazardHandle HazardStore::handleAt(size_t index) const
+{
+    uint32_t slotIndex = m_denseToSlot[index];
+    return HazardHandle{slotIndex, m_slots[slotIndex].generation};
+}
+
+bool HazardHandleSet::insert(HazardHandle handle)
+{
+    if (handle.index >= m_generations.size()) {
+        m_generations.resize(handle.index + 1, 0);
+    }
+    uint32_t &entry = m_generations[handle.index];
+    if (entry == handle.generation + 1) {
+        return false;
+    }
+    entry = handle.generation + 1;
+    return true;
+}
+
+bool HazardHandleSet::contains(HazardHandle handle) const
+{
+    return handle.index < m_generations.size() && m_generations[handle.index] == handle.generation + 1;
+}
@@ -0,0 +1,179 @@
+/**
+ * @file hazardstore.h
+ * @brief Defines the HazardStore slot map that holds the hazards of a world
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef HAZARDSTORE_H
+#define HAZARDSTORE_H
+
+#include "plantcatalog.h"
+#include <box2d/box2d.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Stable reference to a hazard in a HazardStore.
+ *
+ * The generation is bumped every time a slot is freed, so a handle to a removed hazard
+ * never resolves to whatever hazard reuses the slot later.
+ */
+struct HazardHandle {
+    uint32_t index = 0;         // Slot index in the store
+    uint32_t generation = 0;    // Generation the slot had when the handle was issued
+
+    bool operator==(const HazardHandle &other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const HazardHandle &other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Slot map of hazards stored as parallel arrays: O(1) insert, lookup and removal
+ * through stable handles.
+ *
+ * Each field lives in its own densely packed array, so a pass over positions and kinds
+ * (such as drawing) reads nothing else. Plant names, descriptions and images stay in the
+ * plant catalog and are referenced by ID. Removal swaps the last hazard into the freed
+ * place and pops, and the slot table keeps every handle pointing at the right spot.
+ *
+ * A stored body's user data holds its slot index (plus one, so it is never null), which
+ * lets contact callbacks get from a body back to its hazard. Removal clears it again.
+ */
+class HazardStore {
+
+private:
+
+    /**
+     * @brief Indirection from a handle to the dense arrays
+     */
+    struct Slot {
+        uint32_t denseIndex;    // Position of the hazard in the dense arrays while the slot is in use
+        uint32_t generation;    // Bumped on every removal to invalidate old handles
+    };
+
+    // Dense arrays, one entry per hazard, all in the same order
+    std::vector<b2Body*> m_bodies;          // Sensor body of each hazard
+    std::vector<b2Vec2> m_positions;        // World position of each hazard
+    std::vector<float> m_radii;             // Radius of each hazard's sensor
+    std::vector<PlantKind> m_kinds;         // Kind of plant of each hazard
+    std::vector<int> m_plantIds;            // Plant catalog ID of each hazard
+    std::vector<uint32_t> m_denseToSlot;    // Slot index of each hazard
+
+    std::vector<Slot> m_slots;              // Slot table indexed by HazardHandle::index
+    std::vector<uint32_t> m_freeSlots;      // Slots available for reuse
+    uint64_t m_version = 0;                 // Bumped whenever a hazard is added or removed
+
+public:
+
+    /**
+     * @brief Adds a hazard
+     * @param body Sensor body of the hazard; the store tags its user data but does not own it
+     * @param position World position of the hazard
+     * @param radius Radius of the sensor
+     * @param kind Kind of plant
+     * @param plantId Plant catalog ID
+     * @return Handle to the stored hazard
+     */
+    HazardHandle insert(b2Body *body, const b2Vec2 &position, float radius, PlantKind kind, int plantId);
+
+    /**
+     * @brief Looks up where a hazard currently sits in the dense arrays
+     * @param handle Handle returned by insert()
+     * @return Dense index, or -1 if the hazard has been removed
+     */
+    int indexOf(HazardHandle handle) const;
+
+    /**
+     * @brief Finds the hazard a body belongs to
+     * @param body Any body in the world
+     * @param handle Receives the hazard's handle
+     * @return False if the body is not a stored hazard
+     */
+    bool handleOf(const b2Body *body, HazardHandle &handle) const;
+
+    /**
+     * @brief Checks whether a handle still refers to a stored hazard
+     */
+    bool contains(HazardHandle handle) const { return indexOf(handle) >= 0; }
+
+    /**
+     * @brief Removes a hazard by swapping the last hazard into its place
+     * @param handle Handle of the hazard to remove
+     * @return The removed hazard's body, with its user data cleared, for the caller to
+     *         dispose of, or nullptr if already removed
+     */
+    b2Body *remove(HazardHandle handle);
+
+    /**
+     * @brief Forgets every hazard and invalidates all outstanding handles
+     */
+    void clear();
+
+    /**
+     * @brief Reserves room for a number of hazards
+     * @param count Expected number of hazards
+     */
+    void reserve(size_t count);
+
+    /**
+     * @brief Number of stored hazards
+     */
+    size_t size() const { return m_bodies.size(); }
+
+    /**
+     * @brief Changes whenever a hazard is added or removed, so copies of the dense arrays
+     *        can tell whether they are still current
+     */
+    uint64_t version() const { return m_version; }
+
+    /**
+     * @brief Handle of the hazard at a dense index
+     */
+    HazardHandle handleAt(size_t index) const;
+
+    // Dense arrays for iteration, indexed from 0 to size() - 1
+    const std::vector<b2Body*> &bodies() const { return m_bodies; }
+    const std::vector<b2Vec2> &positions() const { return m_positions; }
+    const std::vector<float> &radii() const { return m_radii; }
+    const std::vector<PlantKind> &kinds() const { return m_kinds; }
+    const std::vector<int> &plantIds() const { return m_plantIds; }
+};
+
+/**
+ * @brief Set of hazard handles with O(1) insert and lookup and no hashing.
+ *
+ * A slot holds at most one live hazard at a time and a removed hazard's handle can never
+ * resolve again, so the set keeps a single generation per slot index. Adding a handle for
+ * a slot's newer hazard overwrites the entry of the old one, which keeps the set no larger
+ * than the store's slot table however many hazards come and go.
+ */
+class HazardHandleSet {
+
+private:
+
+    std::vector<uint32_t> m_generations;    // Generation plus one of the member in each slot, 0 if none
+
+public:
+
+    /**
+     * @brief Adds a handle, replacing any older handle of the same slot
+     * @param handle Handle to add
+     * @return False if the handle was already in the set
+     */
+    bool insert(HazardHandle handle);
+
+    /**
+     * @brief Checks whether a handle is in the set
+     */
+    bool contains(HazardHandle handle) const;
+
+    /**
+     * @brief Removes every handle
+     */
+    void clear() { m_generations.clear(); }
+};
+
+#endif // HAZARDSTORE_H
@@ -0,0 +1,163 @@
+/**
+ * @file inputrecording.cpp
+ * @brief Implementation of the InputRecorder and InputReplay classes
+ *
+ * @author Team AJKJ
+ */
+
+#include "inputrecording.h"
+#include "physicsworld.h"
+#include <QFile>
+#include <QSaveFile>
+#include <algorithm>
+#include <cstring>
+
+InputRecorder::InputRecorder() : m_recording(false),
+                                 m_startStep(0) {
+    std::memset(&m_header, 0, sizeof(m_header));
+}
+
+void InputRecorder::start(const PhysicsWorld &world)
+{
+    std::memset(&m_header, 0, sizeof(m_header)); // Keep padding bytes deterministic
+    m_header.magic = InputRecordingHeader::Magic;
+    m_header.version = InputRecordingHeader::CurrentVersion;
+    m_header.byteOrder = InputRecordingHeader::ByteOrderMark;
+    m_header.seed = world.seed();
+    m_header.hazardCount = world.hazardCount();
+    m_header.roadPointCount = world.getTerrainProfile().vertexCount();
+    m_header.quality = static_cast<uint32_t>(world.quality());
+
+    m_inputs.clear();
+    m_startStep = world.stepCount();
+    m_clock.start();
+    m_recording = true;
+}
+
+void InputRecorder::record(const PhysicsWorld &world, float driveForce)
+{
+    if (!m_recording) {
+        return;
+    }
+
+    uint32_t step = static_cast<uint32_t>(world.stepCount() - m_startStep);
+
+    // The same force again on the very next step extends the current run
+    if (!m_inputs.empty()) {
+        RecordedInput &last = m_inputs.back();
+        if (last.driveForce == driveForce && last.step + last.stepCount == step) {
+            last.stepCount++;
+            return;
+        }
+    }
+    m_inputs.push_back({step, 1, static_cast<uint32_t>(m_clock.elapsed()), driveForce});
+}
+
+void InputRecorder::stop(const PhysicsWorld &world)
+{
+    if (!m_recording) {
+        return;
+    }
+    m_header.stepCount = static_cast<uint32_t>(world.stepCount() - m_startStep);
+    m_header.inputCount = static_cast<uint32_t>(m_inputs.size());
+    m_recording = false;
+}
+
+bool InputRecorder::write(const QString &path) const
+{
+    // Lay the file out in memory and write it in one go
+    size_t inputBytes = m_inputs.size() * sizeof(RecordedInput);
+    std::vector<char> buffer(sizeof(m_header) + inputBytes);
+    std::memcpy(buffer.data(), &m_header, sizeof(m_header));
+    if (inputBytes > 0) {
+        std::memcpy(buffer.data() + sizeof(m_header), m_inputs.data(), inputBytes);
+    }
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    if (file.write(buffer.data(), static_cast<qint64>(buffer.size())) != static_cast<qint64>(buffer.size())) {
+        file.cancelWriting();
+        return false;
+    }
+    return file.commit();
+}
+
+InputReplay::InputReplay() : m_nextInput(0),
+                             m_startStep(0) {
+    std::memset(&m_header, 0, sizeof(m_header));
+}
+
+bool InputReplay::open(const QString &path)
+{
+    m_inputs.clear();
+    m_activeInputs.clear();
+    m_nextInput = 0;
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QByteArray data = file.readAll();
+    if (data.size() < static_cast<qsizetype>(sizeof(InputRecordingHeader))) {
+        return false;
+    }
+
+    InputRecordingHeader header;
+    std::memcpy(&header, data.constData(), sizeof(header));
+    qint64 expectedSize = static_cast<qint64>(sizeof(InputRecordingHeader))
+                          + static_cast<qint64>(header.inputCount) * static_cast<qint64>(sizeof(RecordedInput));
+    if (header.magic != InputRecordingHeader::Magic || header.version != InputRecordingHeader::CurrentVersion ||
+        header.byteOrder != InputRecordingHeader::ByteOrderMark || data.size() != expectedSize ||
+        header.quality > static_cast<uint32_t>(PhysicsQuality::Adaptive)) {
+        return false;
+    }
+
+    std::vector<RecordedInput> inputs(header.inputCount);
+    if (header.inputCount > 0) {
+        std::memcpy(inputs.data(), data.constData() + sizeof(header), header.inputCount * sizeof(RecordedInput));
+    }
+
+    // Runs must be non-empty and in step order for the replay cursor
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        if (inputs[i].stepCount == 0 || (i > 0 && inputs[i].step < inputs[i - 1].step)) {
+            return false;
+        }
+    }
+
+    m_header = header;
+    m_inputs = std::move(inputs);
+    return true;
+}
+
+void InputReplay::begin(const PhysicsWorld &world)
+{
+    m_activeInputs.clear();
+    m_nextInput = 0;
+    m_startStep = world.stepCount();
+}
+
+void InputReplay::applyInputs(PhysicsWorld &world)
+{
+    uint64_t step = world.stepCount() - m_startStep;
+
+    // Start the runs that begin at this step and retire the ones that have ended
+    while (m_nextInput < m_inputs.size() && m_inputs[m_nextInput].step <= step) {
+        m_activeInputs.push_back(static_cast<int>(m_nextInput++));
+    }
+    m_activeInputs.erase(std::remove_if(m_activeInputs.begin(), m_activeInputs.end(), [&](int index) {
+        const RecordedInput &input = m_inputs[index];
+        return step >= static_cast<uint64_t>(input.step) + input.stepCount;
+    }), m_activeInputs.end());
+
+    // Runs that share a step were separate calls, applied in recorded order
+    for (int index : m_activeInputs) {
+        world.getVehicle()->applyDriveForce(m_inputs[index].driveForce);
+    }
+}
+
+bool InputReplay::finished(const PhysicsWorld &world) const
+{
+    return world.stepCount() - m_startStep >= m_header.stepCount;
+}
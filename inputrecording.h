@@ -0,0 +1,159 @@
+/**
+ * @file inputrecording.h
+ * @brief Defines the input recording format and the InputRecorder and InputReplay classes
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef INPUTRECORDING_H
+#define INPUTRECORDING_H
+
+#include <QElapsedTimer>
+#include <QString>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+class PhysicsWorld;
+
+// A recording file is one InputRecordingHeader followed by header.inputCount RecordedInput
+// records, in native byte order like a save-state. Steps are counted from the start of the
+// recording, which always begins on a newly built or rebuilt world (PhysicsWorld::rebuild).
+
+/**
+ * @brief One drive force, applied before each of stepCount consecutive steps
+ *
+ * Vehicle::applyDriveForce only lasts until the next step, so holding a key in the game or
+ * a script in simrunner applies the same force step after step. Those repeats are stored
+ * as one run rather than one record per step.
+ */
+struct RecordedInput {
+    uint32_t step;          // First step the force is applied before
+    uint32_t stepCount;     // Consecutive steps it is applied before
+    uint32_t timeMs;        // Wall time since the recording started, for reference only
+    float driveForce;
+};
+
+/**
+ * @brief Start of a recording file: the world to rebuild and how long the recording runs
+ */
+struct InputRecordingHeader {
+    static const uint32_t Magic = 0x52475353;       // "SSGR" read as little-endian
+    static const uint32_t CurrentVersion = 2;
+    static const uint32_t ByteOrderMark = 0x01020304;
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t byteOrder;                             // Detects files from a machine of the other endianness
+    uint32_t seed;                                  // Seed the level was generated from
+    int32_t hazardCount;                            // Hazards requested for the level
+    int32_t roadPointCount;                         // Road vertices, or TerrainProfile::Endless
+    uint32_t stepCount;                             // Steps covered by the recording
+    uint32_t inputCount;                            // RecordedInput records after the header
+    uint32_t quality;                               // PhysicsQuality the recording was made with
+};
+
+static_assert(std::is_trivially_copyable<InputRecordingHeader>::value, "Recording records must be plain data");
+static_assert(std::is_trivially_copyable<RecordedInput>::value, "Recording records must be plain data");
+
+/**
+ * @brief Records every drive force applied to a world, indexed by step
+ */
+class InputRecorder {
+
+private:
+
+    bool m_recording;                       // True between start() and stop()
+    InputRecordingHeader m_header;          // World identity; counts are filled in by stop()
+    std::vector<RecordedInput> m_inputs;    // Runs recorded so far, in step order
+    uint64_t m_startStep;                   // World step count when the recording started
+    QElapsedTimer m_clock;                  // Wall time since the recording started
+
+public:
+
+    InputRecorder();
+
+    /**
+     * @brief Starts a new recording, discarding any previous one. The world must be newly
+     *        built or rebuilt from the seed for the replay to match.
+     * @param world World the inputs will be applied to
+     */
+    void start(const PhysicsWorld &world);
+
+    /**
+     * @brief Records a drive force about to be applied before the world's next step
+     * @param world World the force is applied to
+     * @param driveForce Force passed to Vehicle::applyDriveForce
+     */
+    void record(const PhysicsWorld &world, float driveForce);
+
+    /**
+     * @brief Ends the recording at the world's current step
+     * @param world World the inputs were applied to
+     */
+    void stop(const PhysicsWorld &world);
+
+    /**
+     * @brief Returns whether a recording is in progress
+     */
+    bool isRecording() const { return m_recording; }
+
+    /**
+     * @brief Writes the last stopped recording
+     * @param path File to write
+     * @return True if the whole file was written
+     */
+    bool write(const QString &path) const;
+};
+
+/**
+ * @brief Reads a recording and feeds its inputs back into a world at the recorded steps
+ */
+class InputReplay {
+
+private:
+
+    InputRecordingHeader m_header;          // Header of the open recording
+    std::vector<RecordedInput> m_inputs;    // Runs of the open recording, in step order
+    std::vector<int> m_activeInputs;        // Runs whose steps include the current one
+    size_t m_nextInput;                     // First run not yet started
+    uint64_t m_startStep;                   // World step count when the replay started
+
+public:
+
+    InputReplay();
+
+    /**
+     * @brief Reads a recording file and checks that it is complete and readable on this machine
+     * @param path File to read
+     * @return True if the recording can be replayed
+     */
+    bool open(const QString &path);
+
+    /**
+     * @brief Header of the open recording; only valid after a successful open()
+     */
+    const InputRecordingHeader &header() const { return m_header; }
+
+    /**
+     * @brief Starts replaying from the first input. The world must be built or
+     *        rebuilt from the recorded seed with the recorded settings.
+     * @param world World to replay into
+     */
+    void begin(const PhysicsWorld &world);
+
+    /**
+     * @brief Applies every recorded drive force for the world's next step. Call once
+     *        before each step.
+     * @param world World to replay into
+     */
+    void applyInputs(PhysicsWorld &world);
+
+    /**
+     * @brief Returns whether the world has taken every step the recording covers
+     * @param world World being replayed into
+     */
+    bool finished(const PhysicsWorld &world) const;
+};
+
+#endif // INPUTRECORDING_H
@@ -10,6 +10,7 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
 #include "worldrenderer.h"
+#include "plantcatalog.h"
 #include <QWidget>
 #include <QPushButton>
 #include <QVBoxLayout>
@@ -191,8 +192,8 @@ void MainWindow::startGame()
 }
 
 void MainWindow::tutorialPage() {
-    // Start game after tutorial
-    gameWidget->resetGame();
+    // Start game after tutorial on the level startGame already generated
+    gameWidget->restartLevel();
     m_stackWidget->setCurrentIndex(2);
 }
 
@@ -347,67 +348,6 @@ void MainWindow::showGameClearPopup() {
     scrollLayout->addWidget(plantsHeader);
     scrollLayout->addSpacing(10);
 
-    // Define plant data structure
-    struct PlantData {
-        QString name;
-        QString description;
-        QString imagePath;
-    };
-
-    // Define all plants with their information
-    QMap<QString, PlantData> allPlants = {
-        {"Golden Currant", {
-                               "Golden Currant",
-                               "- Affected parts: Berries and leaves.\n"
-                               "- Effects: Non-toxic in moderate amounts.\n"
-                               "- Use: Rich in antioxidants and vitamins; berries eaten fresh or dried.\n"
-                               " Leaves brewed as tea to reduce inflammation and support immunity.",
-                               ":/safe/Plants/Safe_Plants/golden_currant.jpg"
-                           }},
-        {"Mormon Tea", {
-                           "Mormon Tea",
-                           "- Affected parts: Stems.\n"
-                           "- Effects: Mild stimulant; can raise heart rate if consumed in large quantities.\n"
-                           "- Use: Used to stop bleeding, reduce fever, and treat digestive issues.\n"
-                           " Was historically brewed as tea.",
-                           ":/safe/Plants/Safe_Plants/mormon_tea.jpg"
-                       }},
-        {"Creosote Bush", {
-                              "Creosote Bush",
-                              "- Affected parts: Leaves and stems.\n"
-                              "- Effects: May cause liver or kidney irritation in large amounts.\n"
-                              "- Use: Traditionally used to boost the immune system and reduce symptoms of infections.\n"
-                              " Has antimicrobial properties and was used by Indigenous peoples for colds and wounds.",
-                              ":/safe/Plants/Safe_Plants/creosote_bush.jpg"
-                          }},
-        {"Osha", {
-                     "Osha",
-                     "- Affected parts: Root.\n"
-                     "- Effects: Generally safe in small doses.\n"
-                     "- Use: Used for respiratory issues, sleep aid, and inflammation.\n"
-                     " Often chewed or brewed into tea for sore throats and colds.\n"
-                     " Caution: Resembles Water Hemlock.",
-                     ":/safe/Plants/Safe_Plants/osha.jpg"
-                 }},
-        {"Prairie Flax", {
-                             "Prairie Flax",
-                             "- Affected parts: Seeds and leaves.\n"
-                             "- Effects: Non-toxic; excessive seed intake may cause digestive discomfort.\n"
-                             "- Use: Seeds soothe digestion and freshen breath; leaves contain menthol to relieve nasal congestion.\n"
-                             " Sometimes used for mild respiratory relief.\n"
-                             " Caution: Resembles Lupine/Blue Bonnet.",
-                             ":/safe/Plants/Safe_Plants/prairie_flax.jpg"
-                         }},
-        {"Prickly Pear Cactus", {
-                                    "Prickly Pear Cactus",
-                                    "- Affected parts: Pads and fruit.\n"
-                                    "- Effects: Safe when de-spined and properly prepared.\n"
-                                    "- Use: Eaten for fiber and antioxidants; used to regulate blood sugar and hydration.\n"
-                                    " Pads and fruit are both edible and nutritionally beneficial.",
-                                    ":/safe/Plants/Safe_Plants/prickly_pear_cactus.jpg"
-                                }}
-    };
-
     // Get plants for current level
     QStringList levelPlantNames;
     switch(currentLevel) {
@@ -417,10 +357,12 @@ void MainWindow::showGameClearPopup() {
     }
 
     // Display plant information for each plant in this level
+    const PlantCatalog &catalog = PlantCatalog::instance();
     for (const QString &plantName : levelPlantNames) {
-        if (!allPlants.contains(plantName)) continue;
+        int plantId = catalog.idOf(plantName);
+        if (plantId < 0) continue;
 
-        const PlantData &plant = allPlants[plantName];
+        const PlantData &plant = catalog.plant(plantId);
         QGroupBox *plantGroup = new QGroupBox(plant.name, scrollContent);
         QHBoxLayout *plantLayout = new QHBoxLayout(plantGroup);
 
@@ -0,0 +1,55 @@
+/**
+ * @file parallaxbackground.cpp
+ * @brief Implementation of the ParallaxBackground class
+ *
+ * @author Team AJKJ
+ */
+
+#include "parallaxbackground.h"
+#include <cmath>
+
+ParallaxBackground::ParallaxBackground() : m_devicePixelRatio(0.0) {}
+
+void ParallaxBackground::addLayer(const QPixmap &image, float scrollRate)
+{
+    if (image.isNull()) {
+        return;
+    }
+    m_layers.push_back({image, scrollRate, QPixmap()});
+
+    // Make the new layer's tile on the next draw
+    m_tileSize = QSize();
+}
+
+void ParallaxBackground::updateTiles(const QSize &viewSize, qreal devicePixelRatio)
+{
+    if (viewSize == m_tileSize && devicePixelRatio == m_devicePixelRatio) {
+        return;
+    }
+    m_tileSize = viewSize;
+    m_devicePixelRatio = devicePixelRatio;
+
+    // Scaling happens once here; the scaled pixmap is already in the screen's format
+    for (Layer &layer : m_layers) {
+        QSize tileSize(static_cast<int>(std::ceil(layer.image.width() * devicePixelRatio)),
+                       static_cast<int>(std::ceil(viewSize.height() * devicePixelRatio)));
+        layer.tile = layer.image.scaled(tileSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+        layer.tile.setDevicePixelRatio(devicePixelRatio);
+    }
+}
+
+void ParallaxBackground::draw(QPainter &painter, const QSize &viewSize, qreal devicePixelRatio, float scrollX)
+{
+    if (viewSize.isEmpty()) {
+        return;
+    }
+    updateTiles(viewSize, devicePixelRatio);
+
+    for (const Layer &layer : m_layers) {
+        int tileWidth = layer.image.width();
+        int startX = -static_cast<int>(scrollX * layer.scrollRate) % tileWidth - tileWidth;
+        for (int x = startX; x < viewSize.width(); x += tileWidth) {
+            painter.drawPixmap(x, 0, layer.tile);
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * @file parallaxbackground.h
+ * @brief Defines the ParallaxBackground class that draws the scrolling background layers
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef PARALLAXBACKGROUND_H
+#define PARALLAXBACKGROUND_H
+
+#include <QPainter>
+#include <QPixmap>
+#include <QSize>
+#include <vector>
+
+/**
+ * @brief Background images tiled across the view, each scrolling at its own rate.
+ *
+ * Every layer is stretched to the view's height and repeated horizontally. The stretched
+ * tiles are made once per view size and device pixel ratio and kept as pixmaps, so a
+ * frame only blits them side by side without scaling. Layers are drawn in the order they
+ * were added, so distant layers should be added first and scroll slower.
+ */
+class ParallaxBackground {
+
+private:
+
+    /**
+     * @brief One repeating image
+     */
+    struct Layer {
+        QPixmap image;          // Image as loaded
+        float scrollRate;       // Fraction of the camera's movement the layer scrolls by
+        QPixmap tile;           // Image stretched to the view's height, in device pixels
+    };
+
+    std::vector<Layer> m_layers;    // Layers, back to front
+    QSize m_tileSize;               // View size the tiles were made for
+    qreal m_devicePixelRatio;       // Device pixel ratio the tiles were made for
+
+    /**
+     * @brief Remakes every layer's tile if the view size or device pixel ratio changed
+     */
+    void updateTiles(const QSize &viewSize, qreal devicePixelRatio);
+
+public:
+
+    /**
+     * @brief Constructor for a background with no layers
+     */
+    ParallaxBackground();
+
+    /**
+     * @brief Adds a layer in front of the existing ones. Null images are ignored.
+     * @param image Image to repeat; its width is kept and its height stretched to the view
+     * @param scrollRate 1 scrolls with the world, 0 stays fixed to the view
+     */
+    void addLayer(const QPixmap &image, float scrollRate);
+
+    /**
+     * @brief Fills the view with every layer
+     * @param painter Painter with no transform, drawing in widget coordinates
+     * @param viewSize Size of the widget in logical pixels
+     * @param devicePixelRatio Device pixel ratio of the widget
+     * @param scrollX Camera position in screen pixels; each layer moves by its rate times this
+     */
+    void draw(QPainter &painter, const QSize &viewSize, qreal devicePixelRatio, float scrollX);
+};
+
+#endif // PARALLAXBACKGROUND_H
@@ -0,0 +1,200 @@
+/**
+ * @file physicsthread.cpp
+ * @brief Implementation of the PhysicsThread class
+ *
+ * @author Team AJKJ
+ */
+
+#include "physicsthread.h"
+#include "gameContactListener.h"
+#include <QMutexLocker>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+int64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+PhysicsThread::PhysicsThread(PhysicsWorld *physicsWorld, GameContactListener *contactListener, QObject *parent)
+    : QThread(parent),
+      m_physicsWorld(physicsWorld),
+      m_running(false),
+      m_levelActive(false),
+      m_stopRequested(false),
+      m_idle(true),
+      m_replaying(false) {
+
+    // The listener emits on this thread once a step's contacts are handled; the popup itself
+    // is queued to the GUI thread, so stop stepping right away rather than run on under it
+    connect(contactListener, &GameContactListener::plantContact, this, [this]() {
+        pauseFromThread();
+    }, Qt::DirectConnection);
+
+    publishSnapshot();
+}
+
+PhysicsThread::~PhysicsThread()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_stopRequested = true;
+        m_condition.wakeAll();
+    }
+    wait();
+}
+
+bool PhysicsThread::pause()
+{
+    QMutexLocker locker(&m_mutex);
+    bool wasRunning = m_running;
+    m_running = false;
+
+    // The thread finishes its current step, if any, and reports in as idle
+    while (!m_idle && isRunning()) {
+        m_condition.wait(&m_mutex);
+    }
+    return wasRunning;
+}
+
+void PhysicsThread::resume()
+{
+    QMutexLocker locker(&m_mutex);
+    m_running = true;
+    m_condition.wakeAll();
+}
+
+void PhysicsThread::setLevelActive(bool active)
+{
+    QMutexLocker locker(&m_mutex);
+    m_levelActive = active;
+    m_condition.wakeAll();
+}
+
+void PhysicsThread::queueDriveForce(float force)
+{
+    QMutexLocker locker(&m_mutex);
+    m_pendingForces.push_back(force);
+}
+
+void PhysicsThread::pauseFromThread()
+{
+    QMutexLocker locker(&m_mutex);
+    m_running = false;
+}
+
+bool PhysicsThread::waitUntilRunnable()
+{
+    if (!m_stopRequested && !(m_running && m_levelActive)) {
+        m_idle = true;
+        m_condition.wakeAll();
+        while (!m_stopRequested && !(m_running && m_levelActive)) {
+            m_condition.wait(&m_mutex);
+        }
+        m_idle = false;
+    }
+    return !m_stopRequested;
+}
+
+void PhysicsThread::run()
+{
+    const Clock::duration stepDuration = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(m_physicsWorld->timeStep()));
+    Clock::time_point nextStep = Clock::now();
+
+    for (;;) {
+        std::this_thread::sleep_until(nextStep);
+
+        {
+            QMutexLocker locker(&m_mutex);
+            bool wasIdle = !(m_running && m_levelActive);
+            if (!waitUntilRunnable()) {
+                break;
+            }
+            if (wasIdle) {
+                // Time spent paused must not be simulated
+                nextStep = Clock::now();
+            }
+            m_stepForces.swap(m_pendingForces);
+        }
+
+        applyInputs();
+        m_physicsWorld->step();
+
+        if (m_replaying && m_replay.finished(*m_physicsWorld)) {
+            m_replaying = false;
+        }
+
+        // Publish the step before anything pauses, so a paused game shows where it stopped
+        publish(true);
+
+        if (m_physicsWorld->hasReachedEnd()) {
+            pauseFromThread();
+            emit reachedEnd();
+        }
+
+        // Fell well behind (a stall, a breakpoint): drop the backlog instead of catching up
+        nextStep += stepDuration;
+        if (Clock::now() - nextStep > MaxLagSteps * stepDuration) {
+            nextStep = Clock::now();
+        }
+    }
+}
+
+void PhysicsThread::applyInputs()
+{
+    Vehicle *vehicle = m_physicsWorld->getVehicle();
+
+    // Keyboard input is dropped while the replay drives
+    if (m_replaying) {
+        m_replay.applyInputs(*m_physicsWorld);
+    } else {
+        for (float force : m_stepForces) {
+            m_recorder.record(*m_physicsWorld, force);
+            vehicle->applyDriveForce(force);
+        }
+    }
+    m_stepForces.clear();
+}
+
+void PhysicsThread::publishSnapshot()
+{
+    publish(false);
+}
+
+void PhysicsThread::publish(bool afterStep)
+{
+    RenderSnapshot &snapshot = m_snapshots.back();
+    Vehicle *vehicle = m_physicsWorld->getVehicle();
+    for (int i = 0; i < RenderSnapshot::VehicleBodyCount; ++i) {
+        b2Body *body = (i == 0) ? vehicle->getChassis() : vehicle->getWheel(i - 1);
+        BodyState state = {body->GetPosition(), body->GetAngle()};
+        snapshot.previousVehicle[i] = afterStep ? m_lastVehicle[i] : state;
+        snapshot.vehicle[i] = state;
+        m_lastVehicle[i] = state;
+    }
+
+    // Hazards only change when one is added or removed, so most publishes copy nothing. The
+    // vectors keep their capacity across publishes, so a copy does not allocate once warm.
+    const HazardStore &hazards = m_physicsWorld->getHazards();
+    if (snapshot.hazardVersion != hazards.version()) {
+        snapshot.hazardPositions.assign(hazards.positions().begin(), hazards.positions().end());
+        snapshot.hazardKinds.assign(hazards.kinds().begin(), hazards.kinds().end());
+        snapshot.hazardVersion = hazards.version();
+    }
+    snapshot.step = m_physicsWorld->stepCount();
+    snapshot.publishedNs = nowNs();
+    m_snapshots.publish();
+}
+
+const RenderSnapshot &PhysicsThread::latestSnapshot()
+{
+    m_snapshots.acquire();
+    return m_snapshots.front();
+}
@@ -0,0 +1,169 @@
+/**
+ * @file physicsthread.h
+ * @brief Defines the PhysicsThread class that steps the PhysicsWorld off the GUI thread
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef PHYSICSTHREAD_H
+#define PHYSICSTHREAD_H
+
+#include "inputrecording.h"
+#include "physicsworld.h"
+#include "rendersnapshot.h"
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+#include <atomic>
+#include <vector>
+
+class GameContactListener;
+
+/**
+ * @brief Steps the physics world at a fixed rate on its own thread.
+ *
+ * After every step the thread publishes a RenderSnapshot, which the GUI thread reads
+ * without locking, so painting and stepping never wait for each other. Everything else
+ * that touches the world from the GUI thread (resets, save-states, starting a recording)
+ * happens between pause() and resume(), while the thread is guaranteed to be idle.
+ *
+ * The thread pauses itself when the vehicle touches a plant or reaches the house, and
+ * reports it with a signal so the GUI thread can show the popup or end the level.
+ */
+class PhysicsThread : public QThread {
+    Q_OBJECT
+
+private:
+
+    static const int MaxLagSteps = 5;           // Steps behind schedule before the backlog is dropped
+
+    PhysicsWorld *m_physicsWorld;               // World being stepped; not owned
+
+    QMutex m_mutex;                             // Guards the fields below up to m_pendingForces
+    QWaitCondition m_condition;                 // Signalled when the run state or m_idle changes
+    bool m_running;                             // Stepping is allowed by the GUI
+    bool m_levelActive;                         // The game is in a playable level
+    bool m_stopRequested;                       // The thread should exit
+    bool m_idle;                                // The thread is waiting and will not touch the world
+    std::vector<float> m_pendingForces;         // Drive forces queued by the GUI for the next step
+
+    std::vector<float> m_stepForces;            // Forces being applied this step; thread only
+    InputRecorder m_recorder;                   // Records drive input while recording is on
+    InputReplay m_replay;                       // Feeds recorded drive input back in while replaying
+    std::atomic<bool> m_replaying;              // True while a replay drives the vehicle
+
+    SnapshotBuffer<RenderSnapshot> m_snapshots; // Handed from this thread to the GUI thread
+    BodyState m_lastVehicle[RenderSnapshot::VehicleBodyCount]; // Vehicle states in the last publish
+
+    /**
+     * @brief Blocks until stepping is allowed or a stop is requested. Called with m_mutex held.
+     * @return False if the thread should exit
+     */
+    bool waitUntilRunnable();
+
+    /**
+     * @brief Pauses the thread from inside it; the GUI resumes it once it has reacted
+     */
+    void pauseFromThread();
+
+    /**
+     * @brief Applies the queued or replayed drive input for the next step
+     */
+    void applyInputs();
+
+    /**
+     * @brief Copies the world's current state into the back buffer and publishes it
+     * @param afterStep True after a step, to interpolate from the previous publish; false
+     *        after the GUI changed the world, leaving nothing to interpolate from
+     */
+    void publish(bool afterStep);
+
+protected:
+
+    /**
+     * @brief Thread body: waits while paused and otherwise steps on a fixed schedule
+     */
+    void run() override;
+
+public:
+
+    /**
+     * @brief Constructor. The thread starts paused; call start() and then resume().
+     * @param physicsWorld World to step
+     * @param contactListener Listener whose plant contacts pause the thread
+     * @param parent Parent QObject
+     */
+    PhysicsThread(PhysicsWorld *physicsWorld, GameContactListener *contactListener, QObject *parent = nullptr);
+
+    /**
+     * @brief Destructor stops the thread and waits for it
+     */
+    ~PhysicsThread();
+
+    /**
+     * @brief Stops stepping and waits until the thread is idle, so the caller may touch the world
+     * @return True if stepping was allowed before the call
+     */
+    bool pause();
+
+    /**
+     * @brief Allows stepping again. Time spent paused is not simulated.
+     */
+    void resume();
+
+    /**
+     * @brief Tells the thread whether the game is in a playable level; it only steps in one
+     * @param active True in Level1 to Level3
+     */
+    void setLevelActive(bool active);
+
+    /**
+     * @brief Queues a drive force for the next step, recording it if recording is on.
+     *        Ignored while replaying.
+     * @param force Force passed to Vehicle::applyDriveForce
+     */
+    void queueDriveForce(float force);
+
+    /**
+     * @brief Publishes the world as it is now, with nothing to interpolate from. Call while
+     *        paused, after changing the world from the GUI thread.
+     */
+    void publishSnapshot();
+
+    /**
+     * @brief Switches the GUI thread's view to the newest snapshot. GUI thread only.
+     * @return Newest published snapshot
+     */
+    const RenderSnapshot &latestSnapshot();
+
+    /**
+     * @brief Input recorder. Only touch while paused.
+     */
+    InputRecorder &recorder() { return m_recorder; }
+
+    /**
+     * @brief Input replay. Only touch while paused.
+     */
+    InputReplay &replay() { return m_replay; }
+
+    /**
+     * @brief Returns whether a replay is driving the vehicle
+     */
+    bool isReplaying() const { return m_replaying; }
+
+    /**
+     * @brief Starts or stops driving the vehicle from replay(). Only call while paused.
+     * @param replaying True to drive from the replay
+     */
+    void setReplaying(bool replaying) { m_replaying = replaying; }
+
+signals:
+
+    /**
+     * @brief Emitted from the physics thread when the vehicle reaches grandma's house.
+     *        The thread has paused itself.
+     */
+    void reachedEnd();
+};
+
+#endif // PHYSICSTHREAD_H
@@ -8,105 +8,158 @@
  */
 
 #include "physicsworld.h"
-#include "hazard.h"
+#include "hazardplacer.h"
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+#include <random>
 
-PhysicsWorld::PhysicsWorld(int hazardCount) : m_world(b2Vec2(0.0f, -9.8f)),  // Set gravity: downward 9.8 m/s²
-                                              m_timeStep(1.0f / 60.0f),      // 60 FPS simulation
-                                              m_velocityIterations(6),
-                                              m_positionIterations(2),
-                                              m_contactListener(nullptr) {
+namespace {
 
-    initializePlantDatabase();
+const b2Vec2 Gravity(0.0f, -9.8f);              // Downward 9.8 m/s²
+const b2Vec2 VehicleStartPosition(10.0f, 5.0f); // Where the vehicle starts every level
+const float HazardRadius = 1.0f;                // Radius of each plant's sensor
+const float EndlessRoadPerHazard = 60.0f;       // Meters of endless road per hazard, about a regular level's density
 
-    srand(static_cast<unsigned int>(time(nullptr)));
+// Adaptive quality thresholds
+const float FastSpeed = 12.0f;                  // Chassis speed in m/s that calls for High
+const float IdleSpeed = 0.2f;                   // Chassis speed in m/s below which Low is enough
+const int BusyContactCount = 5;                 // Touching vehicle contacts that call for High
+const int CalmStepsBeforeDrop = 30;             // Half a second of calm before stepping down
 
-    // Create the player's vehicle at an initial position
-    m_vehicle = new Vehicle(m_world, b2Vec2(10.0f, 5.0f));
-
-
-    // Define static ground body to represent terrain
-    b2BodyDef groundBodyDef;
-    groundBodyDef.position.Set(0.0f, 0.0f);
-    b2Body *groundBody = m_world.CreateBody(&groundBodyDef);
-
-
-    // Create road with terrain features
-    const int segmentCount = 10;           // Number of points per pattern
-    const int repetitions = 10;            // How many times the pattern is repeated
-    const int roadPointCount = segmentCount * repetitions;
-    b2Vec2 roadPoints[roadPointCount];
-
-    // Y-coordinate changes (Δy) for each segment to create slope up and down
-    float deltaY[segmentCount] = {
-        0.0f,
-        0.5f,
-        1.0f,
-        1.2f,
-        1.0f,
-        -0.5f,
-        -1.0f,
-        -0.8f,
-        -0.5f,
-        -0.9f
-    };
+const size_t ContactEventCapacity = 64;         // Contact events a step can hold without allocating
+
+// Bounds a save-state's values must be within before they reach Box2D
+const float MaxSavedHazardRadius = 10.0f;       // Sensors are a meter across; anything far bigger is damage
+const float MaxSavedCoordinate = 1.0e7f;        // Meters from the origin, far past the end of any road
+const float MaxSavedSpeed = 1.0e4f;             // Linear or angular speed, far above anything the car reaches
+
+/**
+ * @brief Checks that a saved value is a real number no larger than a bound
+ */
+bool isWithin(float value, float bound)
+{
+    return std::isfinite(value) && std::fabs(value) <= bound;
+}
 
-    float segmentWidth = 10.0f;  // Distance between each x point
-    float currentY = -2.0f;      // Initial y-position of the road
+/**
+ * @brief Checks that a saved body can be put back into Box2D
+ */
+bool isValidBody(const SavedBody &body)
+{
+    return isWithin(body.positionX, MaxSavedCoordinate) && isWithin(body.positionY, MaxSavedCoordinate) &&
+           std::isfinite(body.angle) &&
+           isWithin(body.linearVelocityX, MaxSavedSpeed) && isWithin(body.linearVelocityY, MaxSavedSpeed) &&
+           isWithin(body.angularVelocity, MaxSavedSpeed);
+}
 
-    // Generate road points by accumulating y-values
-    for (int i = 0; i < roadPointCount; ++i) {
-        float x = i * segmentWidth;
-        currentY += deltaY[i % segmentCount];  // Accumulate y to make smooth transitions
-        roadPoints[i] = b2Vec2(x, currentY);
+} // namespace
+
+const char *toString(PhysicsQuality quality)
+{
+    switch (quality) {
+    case PhysicsQuality::Low:
+        return "low";
+    case PhysicsQuality::Default:
+        return "default";
+    case PhysicsQuality::High:
+        return "high";
+    case PhysicsQuality::Adaptive:
+        return "adaptive";
+    }
+    return "unknown";
+}
+
+PhysicsWorld::PhysicsWorld(int hazardCount, unsigned int seed, int roadPointCount, const VehicleSpec &vehicleSpec) : m_world(new b2World(Gravity)),
+                                                                                                                     m_seed(seed),
+                                                                                                                     m_random(seed),
+                                                                                                                     m_timeStep(1.0f / 60.0f),      // 60 FPS simulation
+                                                                                                                     m_quality(PhysicsQuality::Default),
+                                                                                                                     m_solver(solverSettingsFor(PhysicsQuality::Default)),
+                                                                                                                     m_adaptiveTier(PhysicsQuality::Default),
+                                                                                                                     m_calmSteps(0),
+                                                                                                                     m_stepCount(0),
+                                                                                                                     m_terrainProfile(roadPointCount),
+                                                                                                                     m_hazardCount(hazardCount),
+                                                                                                                     m_activeBegin(0),
+                                                                                                                     m_activeEnd(0),
+                                                                                                                     m_activationRadius(50.0f),  // Well beyond the visible part of the road
+                                                                                                                     m_rightWall(nullptr),
+                                                                                                                     m_contactEvents(&m_hazards, ContactEventCapacity),
+                                                                                                                     m_contactHandler(nullptr),
+                                                                                                                     m_unplacedHazardCount(0) {
+    if (m_terrainProfile.vertexCount() != roadPointCount) {
+        qWarning() << "Road cut from" << roadPointCount << "to" << m_terrainProfile.vertexCount()
+                   << "points to end within" << TerrainProfile::MaxPreciseX << "m";
     }
+    buildLevel(vehicleSpec);
+}
+
+void PhysicsWorld::buildLevel(const VehicleSpec &vehicleSpec) {
+
+    // Box2D only ever reports contacts into the buffer
+    m_world->SetContactListener(&m_contactEvents);
+
+    // Create the player's vehicle at an initial position
+    m_vehicle = new Vehicle(*m_world, VehicleStartPosition, vehicleSpec);
+
 
-    // Create a Box2D chain shape using the generated points
-    b2ChainShape roadChain;
-    roadChain.CreateChain(roadPoints, roadPointCount);
-    groundBody->CreateFixture(&roadChain, 0.0f);
+    // Create the road. It is streamed in chunks around the vehicle, so only the part
+    // near the vehicle exists in the physics world at any time.
+    m_terrain = new Terrain(*m_world, m_terrainProfile);
+    m_terrain->update(m_vehicle->getChassis()->GetPosition().x);
 
     // Create static wall at the beginning of the road
     b2BodyDef leftWallDef;
-    leftWallDef.position.Set(0.0f, currentY); // use currentY after loop
-    b2Body* leftWall = m_world.CreateBody(&leftWallDef);
+    leftWallDef.position.Set(0.0f, m_terrainProfile.vertexHeight(0));
+    m_leftWall = m_world->CreateBody(&leftWallDef);
 
     b2PolygonShape leftShape;
     leftShape.SetAsBox(0.5f, 10.0f); // width 1m, height 20m
-    leftWall->CreateFixture(&leftShape, 0.0f);
+    m_leftWall->CreateFixture(&leftShape, 0.0f);
 
-    // Create static wall at the end of the road
-    float endX = (roadPointCount - 1) * segmentWidth;
+    // Create static wall at the end of the road. Endless roads have no end, but the vehicle
+    // is stopped where float x gets too coarse for the physics.
     b2BodyDef rightWallDef;
-    rightWallDef.position.Set(endX, currentY); // same height
-    b2Body* rightWall = m_world.CreateBody(&rightWallDef);
+    if (m_terrainProfile.isEndless()) {
+        rightWallDef.position.Set(TerrainProfile::MaxPreciseX, m_terrainProfile.heightAt(TerrainProfile::MaxPreciseX));
+    } else {
+        rightWallDef.position.Set(m_terrainProfile.endX(), m_terrainProfile.vertexHeight(m_terrainProfile.vertexCount() - 1));
+    }
+    m_rightWall = m_world->CreateBody(&rightWallDef);
 
     b2PolygonShape rightShape;
     rightShape.SetAsBox(0.5f, 10.0f);
-    rightWall->CreateFixture(&rightShape, 0.0f);
+    m_rightWall->CreateFixture(&rightShape, 0.0f);
 
     // --------Generate random hazards along the road--------
+    spawnHazards();
+    updateActiveRegion(m_vehicle->getChassis()->GetPosition().x);
+    captureLevelSnapshot();
+}
 
-    // Calculate road bounds for hazard placement
-    float roadStartX = 15.0f; // Safe margin from start
-    float roadEndX = (roadPointCount - 1) * segmentWidth - 15.0f; // Safe margin from end
-    float roadLength = roadEndX - roadStartX;
+PhysicsWorld::~PhysicsWorld()
+{
+    // Clean up dynamically created vehicle and terrain objects. Hazard bodies, pooled or
+    // not, are destroyed along with the Box2D world.
+    delete m_vehicle;
+    delete m_terrain;
 
-    // Separate plants by type
-    std::vector<int> poisonousPlantIndices;
-    std::vector<int> herbPlantIndices;
-
-    // Categorize plants by type
-    for (int i = 0; i < m_plantDatabase.size(); i++) {
-        if (m_plantDatabase[i].type == "poisonous") {
-            poisonousPlantIndices.push_back(i);
-        } else if (m_plantDatabase[i].type == "herb") {
-            herbPlantIndices.push_back(i);
-        }
+    if (m_contactHandler) {
+        delete m_contactHandler;
     }
+}
+
+void PhysicsWorld::spawnHazards()
+{
+    // Separate plants by type
+    const PlantCatalog &catalog = PlantCatalog::instance();
+    std::vector<int> poisonousPlantIndices = catalog.idsOfKind(PlantKind::Poisonous);
+    const std::vector<int> &herbPlantIndices = catalog.idsOfKind(PlantKind::Herb);
 
     // Fisher-Yates shuffle for poisonous plants
     for (int i = poisonousPlantIndices.size() - 1; i > 0; i--) {
-        int j = rand() % (i + 1);
+        int j = m_random.nextInt(i + 1);
         std::swap(poisonousPlantIndices[i], poisonousPlantIndices[j]);
     }
 
@@ -120,130 +173,292 @@ PhysicsWorld::PhysicsWorld(int hazardCount) : m_world(b2Vec2(0.0f, -9.8f)),  //
 
     // Shuffle the combined list of plant indices
     for (int i = selectedPlantIndices.size() - 1; i > 0; i--) {
-        int j = rand() % (i + 1);
+        int j = m_random.nextInt(i + 1);
         std::swap(selectedPlantIndices[i], selectedPlantIndices[j]);
     }
 
-    // Create an array of possible X positions along the road
-    int actualHazardCount = selectedPlantIndices.size(); // Should be 16 (5 poisonous + 11 herbs)
-    std::vector<float> hazardPositions;
-
-    // Generate possible positions with minimum spacing
-    float minSpacing = roadLength / (actualHazardCount * 1.5f); // Ensure some minimum spacing
-    for (int i = 0; i < actualHazardCount; i++) {
-        float position;
-        bool validPosition;
-
-        // Try to find a position that's not too close to existing positions
-        int maxAttempts = 20;
-        int attempts = 0;
-
-        do {
-            validPosition = true;
-            position = roadStartX + (static_cast<float>(rand()) / RAND_MAX) * roadLength;
-
-            // Check distance from all existing positions
-            for (float existingPos : hazardPositions) {
-                if (std::abs(position - existingPos) < minSpacing) {
-                    validPosition = false;
-                    break;
-                }
-            }
-            attempts++;
-        } while (!validPosition && attempts < maxAttempts);
-
-        hazardPositions.push_back(position);
-    }
-
-    // Place plants at random positions (ensure they stay on the road)
-    int placedCount = 0;
-    int attempts = 0;
-    int maxPlacementAttempts = 100;
-
-    while (placedCount < actualHazardCount && attempts < maxPlacementAttempts) {
-        float hazardX = hazardPositions[placedCount];
-
-        int segmentIndex = static_cast<int>(hazardX / segmentWidth);
-        segmentIndex = std::min(segmentIndex, roadPointCount - 2);
-
-        // Skip upward slopes
-        float slope = deltaY[segmentIndex % segmentCount];
-        if (slope > 0.0f) {
-            attempts++;
-            // Try finding a new position
-            float newPosition;
-            bool validPosition;
-            int innerAttempts = 0;
-            do {
-                validPosition = true;
-                newPosition = roadStartX + (static_cast<float>(rand()) / RAND_MAX) * roadLength;
-
-                for (float existingPos : hazardPositions) {
-                    if (std::abs(newPosition - existingPos) < minSpacing) {
-                        validPosition = false;
-                        break;
-                    }
-                }
-
-                innerAttempts++;
-            } while (!validPosition && innerAttempts < 20);
-
-            hazardPositions[placedCount] = newPosition;
-            continue;
+    // Every selected plant appears at least once; larger counts cycle through the selection
+    int actualHazardCount = std::max(m_hazardCount, static_cast<int>(selectedPlantIndices.size())); // At least 16 (5 poisonous + 11 herbs)
+
+    // Calculate road bounds for hazard placement. An endless road has no end to fill, so
+    // the hazards get a default level's worth of road or, when there are more of them,
+    // as much road as keeps them as far apart as on a regular level. That road stops at
+    // the precision limit; past it the hazards are packed closer instead.
+    float roadStartX = 15.0f; // Safe margin from start
+    float roadEndX = m_terrainProfile.endX();
+    if (m_terrainProfile.isEndless()) {
+        roadEndX = std::max(m_terrainProfile.vertexX(DefaultRoadPointCount - 1),
+                            actualHazardCount * EndlessRoadPerHazard);
+        if (roadEndX > TerrainProfile::MaxPreciseX) {
+            qWarning() << "Placing" << actualHazardCount << "hazards within" << TerrainProfile::MaxPreciseX
+                       << "m instead of" << roadEndX << "m of endless road";
+            roadEndX = TerrainProfile::MaxPreciseX;
         }
+    }
+    roadEndX -= 15.0f; // Safe margin from end
 
-        // Interpolate Y position
-        float segmentPosition = (hazardX - segmentIndex * segmentWidth) / segmentWidth;
+    // Scatter hazards over flat and downhill road, keeping a minimum spacing between them
+    HazardPlacer placer(m_terrainProfile);
+    float minSpacing = placer.allowedLength(roadStartX, roadEndX) / (actualHazardCount * 1.5f); // Ensure some minimum spacing
+    PlacementResult placement = placer.place(actualHazardCount, roadStartX, roadEndX, minSpacing, m_random);
 
-        float startY = -2.0f;
-        for (int j = 0; j < segmentIndex; j++) {
-            startY += deltaY[j % segmentCount];
-        }
+    m_unplacedHazardCount = placement.unplacedCount;
+    if (m_unplacedHazardCount > 0) {
+        qWarning() << "Could not place" << m_unplacedHazardCount << "of" << actualHazardCount << "hazards";
+    }
 
-        float endY = startY + deltaY[segmentIndex % segmentCount];
-        float hazardY = startY + segmentPosition * (endY - startY);
-        hazardY += 0.7f;
+    // Place plants at the chosen positions. Positions come out ascending, so m_hazardsByX
+    // is filled in order.
+    m_hazards.reserve(placement.positions.size());
+    m_hazardsByX.clear();
+    m_hazardsByX.reserve(placement.positions.size());
+    for (size_t placedCount = 0; placedCount < placement.positions.size(); ++placedCount) {
+        float hazardX = placement.positions[placedCount];
 
-        int plantIndex = selectedPlantIndices[placedCount];
-        const PlantData& plant = m_plantDatabase[plantIndex];
+        // Sit the plant just above the road surface
+        float hazardY = m_terrainProfile.heightAt(hazardX) + 0.7f;
 
-        m_hazards.push_back(new Hazard(
-            m_world,
-            b2Vec2(hazardX, hazardY),
-            1.0,
-            plant.type,
-            plant.name,
-            plant.description,
-            plant.imagePath
-            ));
+        int plantId = selectedPlantIndices[placedCount % selectedPlantIndices.size()];
+        const PlantData& plant = catalog.plant(plantId);
 
-        placedCount++;
+        addHazard(b2Vec2(hazardX, hazardY), HazardRadius, plant.kind, plantId);
     }
+
+    // New hazards start outside the activation window until the next update brings them in
+    m_activeBegin = 0;
+    m_activeEnd = 0;
+
+    // Make sure every hazard can go back into the pool without it growing
+    m_hazardBodyPool.reserve(m_hazards.size() + m_hazardBodyPool.size());
 }
 
-PhysicsWorld::~PhysicsWorld()
+b2Body *PhysicsWorld::acquireHazardBody(const b2Vec2 &position, float radius)
 {
-    // Clean up dynamically created vehicle and hazard objects
-    delete m_vehicle;
-    for (Hazard* hazard : m_hazards)
-        delete hazard;
-
-    if (m_contactListener) {
-        delete m_contactListener;
+    if (m_hazardBodyPool.empty()) {
+        // Define an inactive static body at the specified position
+        b2BodyDef bodyDef;
+        bodyDef.type = b2_staticBody;
+        bodyDef.position = position;
+        bodyDef.active = false;
+        b2Body *body = m_world->CreateBody(&bodyDef);
+
+        // Represent the hazard as a simple circular sensor
+        b2CircleShape circle;
+        circle.m_radius = radius;
+
+        b2FixtureDef fixtureDef;
+        fixtureDef.shape = &circle;
+        fixtureDef.isSensor = true;  // Detect collisions
+        body->CreateFixture(&fixtureDef);
+        return body;
     }
+
+    // Pooled bodies are inactive, so they can be moved and resized without touching the broad-phase
+    b2Body *body = m_hazardBodyPool.back();
+    m_hazardBodyPool.pop_back();
+    body->SetTransform(position, 0.0f);
+    body->GetFixtureList()->GetShape()->m_radius = radius;
+    return body;
+}
+
+void PhysicsWorld::addHazard(const b2Vec2 &position, float radius, PlantKind kind, int plantId)
+{
+    b2Body *body = acquireHazardBody(position, radius);
+    HazardHandle handle = m_hazards.insert(body, position, radius, kind, plantId);
+    m_hazardsByX.push_back({position.x, handle});
+}
+
+void PhysicsWorld::releaseHazardBody(b2Body *body)
+{
+    // Inactive bodies leave the broad-phase and take part in no contacts
+    body->SetActive(false);
+    m_hazardBodyPool.push_back(body);
+}
+
+unsigned int PhysicsWorld::randomSeed()
+{
+    std::random_device device;
+    return device();
 }
 
 // Advance the simulation one time step
 void PhysicsWorld::step()
 {
-    m_world.Step(m_timeStep, m_velocityIterations, m_positionIterations);
+    if (m_quality == PhysicsQuality::Adaptive) {
+        adaptSolver();
+    }
+
+    // Only contacts from this step's solve are handed on; ends reported while bodies were
+    // released between steps are dropped
+    m_contactEvents.clear();
+
+    // Sub-steps split the time step evenly; contacts from all of them are handled together
+    if (m_solver.subSteps == 1) {
+        m_world->Step(m_timeStep, m_solver.velocityIterations, m_solver.positionIterations);
+    } else {
+        // Drive forces must act on every sub-step, not only the first
+        float subStep = m_timeStep / m_solver.subSteps;
+        m_world->SetAutoClearForces(false);
+        for (int i = 0; i < m_solver.subSteps; ++i) {
+            m_world->Step(subStep, m_solver.velocityIterations, m_solver.positionIterations);
+            limitVehicleSpeed();
+        }
+        m_world->ClearForces();
+        m_world->SetAutoClearForces(true);
+    }
+    m_stepCount++;
+
+    // Game logic sees the step's contacts only now that the solver is done, in one batch
+    if (m_contactHandler && !m_contactEvents.events().empty()) {
+        m_contactHandler->handleContacts(m_contactEvents.events());
+    }
     processRemovalQueue();
+
+    // Stream road chunks in and out around the vehicle and keep nearby bodies active
+    float vehicleX = m_vehicle->getChassis()->GetPosition().x;
+    m_terrain->update(vehicleX);
+    updateActiveRegion(vehicleX);
+}
+
+bool PhysicsWorld::hasReachedEnd() const
+{
+    if (m_terrainProfile.isEndless()) {
+        return false;
+    }
+
+    // Grandma's house stands one meter above the end of the road
+    float houseX = m_terrainProfile.endX();
+    b2Vec2 house(houseX, m_terrainProfile.heightAt(houseX) + 1.0f);
+    return b2Distance(m_vehicle->getChassis()->GetPosition(), house) <= ArrivalThreshold;
+}
+
+SolverSettings PhysicsWorld::solverSettingsFor(PhysicsQuality quality)
+{
+    switch (quality) {
+    case PhysicsQuality::Low:
+        return {1, 4, 1};
+    case PhysicsQuality::High:
+        return {2, 8, 3};
+    default:
+        return {1, 6, 2};
+    }
+}
+
+void PhysicsWorld::setQuality(PhysicsQuality quality)
+{
+    m_quality = quality;
+    resetAdaptiveSolver();
+    if (quality != PhysicsQuality::Adaptive) {
+        m_solver = solverSettingsFor(quality);
+    }
+}
+
+void PhysicsWorld::resetAdaptiveSolver()
+{
+    m_calmSteps = 0;
+    if (m_quality == PhysicsQuality::Adaptive) {
+        m_adaptiveTier = PhysicsQuality::Default;
+        m_solver = solverSettingsFor(m_adaptiveTier);
+    }
+}
+
+void PhysicsWorld::limitVehicleSpeed()
+{
+    // Box2D caps how far a body moves per Step, which is the car's top speed at one step
+    // per time step. Shorter sub-steps would raise it, so hold the vehicle to the same cap.
+    const float maxSpeed = b2_maxTranslation / m_timeStep;
+    for (int i = 0; i < LevelSnapshot::VehicleBodyCount; ++i) {
+        b2Body *body = vehicleBody(i);
+        b2Vec2 velocity = body->GetLinearVelocity();
+        float speed = velocity.Length();
+        if (speed > maxSpeed) {
+            body->SetLinearVelocity((maxSpeed / speed) * velocity);
+        }
+    }
+}
+
+void PhysicsWorld::adaptSolver()
+{
+    // Only the vehicle moves, so its speed and touching contacts tell how hard the step is
+    float speed = m_vehicle->getChassis()->GetLinearVelocity().Length();
+    int contactCount = 0;
+    for (int i = 0; i < LevelSnapshot::VehicleBodyCount; ++i) {
+        for (b2ContactEdge *edge = vehicleBody(i)->GetContactList(); edge; edge = edge->next) {
+            contactCount += edge->contact->IsTouching() ? 1 : 0;
+        }
+    }
+
+    PhysicsQuality target = PhysicsQuality::Default;
+    if (speed > FastSpeed || contactCount >= BusyContactCount) {
+        target = PhysicsQuality::High;
+    } else if (speed < IdleSpeed) {
+        target = PhysicsQuality::Low;
+    }
+
+    if (target > m_adaptiveTier) {
+        m_adaptiveTier = target;
+        m_calmSteps = 0;
+    } else if (target < m_adaptiveTier && ++m_calmSteps >= CalmStepsBeforeDrop) {
+        m_adaptiveTier = target;
+        m_calmSteps = 0;
+    } else if (target == m_adaptiveTier) {
+        m_calmSteps = 0;
+    }
+    m_solver = solverSettingsFor(m_adaptiveTier);
+}
+
+void PhysicsWorld::updateActiveRegion(float focusX)
+{
+    float lowX = focusX - m_activationRadius;
+    float highX = focusX + m_activationRadius;
+
+    // Walls are few enough to test directly
+    m_leftWall->SetActive(std::fabs(m_leftWall->GetPosition().x - focusX) <= m_activationRadius);
+    if (m_rightWall) {
+        m_rightWall->SetActive(std::fabs(m_rightWall->GetPosition().x - focusX) <= m_activationRadius);
+    }
+
+    // Removed hazards have stale handles and stay in the pool, inactive
+    auto setActive = [this](int index, bool active) {
+        int hazardIndex = m_hazards.indexOf(m_hazardsByX[index].handle);
+        if (hazardIndex >= 0) {
+            m_hazards.bodies()[hazardIndex]->SetActive(active);
+        }
+    };
+
+    // If the window jumped clear of the current one, drop everything and restart from
+    // the new low end with a binary search
+    int count = static_cast<int>(m_hazardsByX.size());
+    if (m_activeBegin == m_activeEnd || highX < m_hazardsByX[m_activeBegin].x ||
+        lowX > m_hazardsByX[m_activeEnd - 1].x) {
+        for (int i = m_activeBegin; i < m_activeEnd; ++i) {
+            setActive(i, false);
+        }
+        auto first = std::lower_bound(m_hazardsByX.begin(), m_hazardsByX.end(), lowX,
+                                      [](const HazardSlot &slot, float x) { return slot.x < x; });
+        m_activeBegin = static_cast<int>(first - m_hazardsByX.begin());
+        m_activeEnd = m_activeBegin;
+    }
+
+    // Otherwise the windows overlap and only the ends move
+    while (m_activeEnd < count && m_hazardsByX[m_activeEnd].x <= highX) {
+        setActive(m_activeEnd++, true);
+    }
+    while (m_activeEnd > m_activeBegin && m_hazardsByX[m_activeEnd - 1].x > highX) {
+        setActive(--m_activeEnd, false);
+    }
+    while (m_activeBegin < m_activeEnd && m_hazardsByX[m_activeBegin].x < lowX) {
+        setActive(m_activeBegin++, false);
+    }
+    while (m_activeBegin > 0 && m_hazardsByX[m_activeBegin - 1].x >= lowX) {
+        setActive(--m_activeBegin, true);
+    }
 }
 
 // Accessor for Box2D world
 b2World &PhysicsWorld::getWorld()
 {
-    return m_world;
+    return *m_world;
 }
 
 // Accessor for the player vehicle
@@ -253,291 +468,301 @@ Vehicle *PhysicsWorld::getVehicle() const
 }
 
 
-void PhysicsWorld::setContactListener(b2ContactListener* listener) {
-    if (m_contactListener) {
-        delete m_contactListener;
+void PhysicsWorld::setContactHandler(ContactHandler* handler) {
+    if (m_contactHandler) {
+        delete m_contactHandler;
     }
-    m_contactListener = listener;
-    m_world.SetContactListener(listener);
+    m_contactHandler = handler;
 }
 
-void PhysicsWorld::queueForRemoval(b2Body* hazardBody) {
-    // Add the body to the removal queue
-    m_removeQueue.push_back(hazardBody);
+void PhysicsWorld::queueForRemoval(HazardHandle handle) {
+    m_removeQueue.push_back(handle);
 }
 
 void PhysicsWorld::processRemovalQueue() {
-    // Process only a limited number of bodies per frame to avoid stressing Box2D
-    const int maxRemovalsPerFrame = 3;
-    int removalsThisFrame = 0;
-
-    // Create a temporary list of bodies we actually removed
-    std::vector<b2Body*> removedBodies;
-
-    for (auto it = m_removeQueue.begin(); it != m_removeQueue.end() && removalsThisFrame < maxRemovalsPerFrame;) {
-        b2Body* bodyToRemove = *it;
-
-        // Find and remove the hazard from the hazards vector
-        bool hazardFound = false;
-        for (auto hazardIt = m_hazards.begin(); hazardIt != m_hazards.end(); ++hazardIt) {
-            if ((*hazardIt)->getBody() == bodyToRemove) {
-                // Delete the hazard object
-                delete *hazardIt;
-
-                // Remove from vector
-                m_hazards.erase(hazardIt);
-                hazardFound = true;
-                break;
-            }
+    for (const HazardHandle &handle : m_removeQueue) {
+        // A stale handle (hazard already removed) resolves to nullptr and is skipped
+        b2Body* body = m_hazards.remove(handle);
+        if (body) {
+            releaseHazardBody(body);
         }
+    }
+    m_removeQueue.clear();
+}
 
-        if (hazardFound) {
-            // Now safely destroy the Box2D body
-            try {
-                m_world.DestroyBody(bodyToRemove);
-                removedBodies.push_back(bodyToRemove);
-                it = m_removeQueue.erase(it);
-                removalsThisFrame++;
-            }
-            catch (...) {
-                // If destruction fails, move to next body
-                ++it;
-            }
-        }
-        else {
-            // If hazard wasn't found, move to next body
-            ++it;
+void PhysicsWorld::reset(unsigned int seed) {
+    // Same seed, same level: restoring the snapshot is much cheaper than regenerating
+    if (seed == m_seed) {
+        restartLevel();
+        return;
+    }
+
+    generateLevel(seed);
+}
+
+void PhysicsWorld::generateLevel(unsigned int seed) {
+    releaseAllHazards();
+
+    // Restart the generator so the level matches a fresh world built from the same seed
+    m_seed = seed;
+    m_random = RandomGenerator(seed);
+    m_unplacedHazardCount = 0;
+
+    // Put the vehicle back at the start and reload the road around it
+    m_vehicle->reset(VehicleStartPosition);
+    m_vehicle->resetSolverState();
+    m_terrain->update(m_vehicle->getChassis()->GetPosition().x);
+
+    spawnHazards();
+    updateActiveRegion(m_vehicle->getChassis()->GetPosition().x);
+    captureLevelSnapshot();
+    resetAdaptiveSolver();
+}
+
+void PhysicsWorld::rebuild(unsigned int seed) {
+    VehicleSpec vehicleSpec = m_vehicle->spec();
+
+    // Empty the hazard store while its bodies still exist, then tear the rest down with
+    // the Box2D world; pooled hazard bodies go with it
+    releaseAllHazards();
+    m_hazardBodyPool.clear();
+    m_hazardsByX.clear();
+    m_activeBegin = 0;
+    m_activeEnd = 0;
+    delete m_vehicle;
+    delete m_terrain;
+    m_rightWall = nullptr;
+    m_contactEvents.clear();
+    m_world.reset(new b2World(Gravity));
+
+    // Start from the state a new world is constructed with
+    m_seed = seed;
+    m_random = RandomGenerator(seed);
+    m_unplacedHazardCount = 0;
+    m_adaptiveTier = PhysicsQuality::Default;
+    m_calmSteps = 0;
+    if (m_quality == PhysicsQuality::Adaptive) {
+        m_solver = solverSettingsFor(m_adaptiveTier);
+    }
+
+    buildLevel(vehicleSpec);
+}
+
+void PhysicsWorld::restartLevel() {
+    releaseAllHazards();
+    resetAdaptiveSolver();
+
+    // Vehicle bodies and wheel motors
+    for (int i = 0; i < LevelSnapshot::VehicleBodyCount; ++i) {
+        b2Body *body = vehicleBody(i);
+        const BodySnapshot &state = m_levelSnapshot.vehicleBodies[i];
+        body->SetTransform(state.position, state.angle);
+        body->SetLinearVelocity(state.linearVelocity);
+        body->SetAngularVelocity(state.angularVelocity);
+        body->SetAwake(state.awake);
+    }
+
+    // Joint and contact impulses from the last run would otherwise warm-start this one
+    m_vehicle->resetSolverState();
+    for (int i = 0; i < 2; ++i) {
+        m_vehicle->getWheelJoint(i)->SetMotorSpeed(m_levelSnapshot.wheelMotorSpeeds[i]);
+    }
+
+    // Hazards come back on pooled bodies; the pool holds one for every hazard ever spawned
+    m_hazardsByX.clear();
+    for (const HazardSnapshot &hazard : m_levelSnapshot.hazards) {
+        addHazard(hazard.position, hazard.radius, hazard.kind, hazard.plantId);
+    }
+    m_activeBegin = 0;
+    m_activeEnd = 0;
+
+    m_random.setState(m_levelSnapshot.randomState);
+    m_unplacedHazardCount = m_levelSnapshot.unplacedHazardCount;
+
+    float vehicleX = m_vehicle->getChassis()->GetPosition().x;
+    m_terrain->update(vehicleX);
+    updateActiveRegion(vehicleX);
+}
+
+void PhysicsWorld::captureLevelSnapshot() {
+    for (int i = 0; i < LevelSnapshot::VehicleBodyCount; ++i) {
+        const b2Body *body = vehicleBody(i);
+        BodySnapshot &state = m_levelSnapshot.vehicleBodies[i];
+        state.position = body->GetPosition();
+        state.angle = body->GetAngle();
+        state.linearVelocity = body->GetLinearVelocity();
+        state.angularVelocity = body->GetAngularVelocity();
+        state.awake = body->IsAwake();
+    }
+    for (int i = 0; i < 2; ++i) {
+        m_levelSnapshot.wheelMotorSpeeds[i] = m_vehicle->getWheelJoint(i)->GetMotorSpeed();
+    }
+
+    // Record hazards in x order so restoring rebuilds the activation index directly
+    m_levelSnapshot.hazards.clear();
+    m_levelSnapshot.hazards.reserve(m_hazardsByX.size());
+    for (const HazardSlot &slot : m_hazardsByX) {
+        int index = m_hazards.indexOf(slot.handle);
+        if (index >= 0) {
+            m_levelSnapshot.hazards.push_back({m_hazards.positions()[index], m_hazards.radii()[index],
+                                               m_hazards.kinds()[index], m_hazards.plantIds()[index]});
         }
     }
+
+    m_levelSnapshot.randomState = m_random.state();
+    m_levelSnapshot.unplacedHazardCount = m_unplacedHazardCount;
 }
 
-// physicsworld.cpp - update reset method
-void PhysicsWorld::reset() {
-    // Clear existing hazards
-    for(auto hazard : m_hazards) {
-        m_world.DestroyBody(hazard->getBody());
-        delete hazard;
+void PhysicsWorld::releaseAllHazards() {
+    // Return every hazard to the pool; their bodies stay in the world, deactivated
+    for (b2Body* body : m_hazards.bodies()) {
+        releaseHazardBody(body);
     }
     m_hazards.clear();
+    m_removeQueue.clear();
+}
 
-    // Select two random plants for the initial hazards
-    int plantIndex1 = rand() % m_plantDatabase.size();
-    int plantIndex2 = (plantIndex1 + rand() % (m_plantDatabase.size() - 1) + 1) % m_plantDatabase.size(); // Ensure different plants
-
-    const PlantData& plant1 = m_plantDatabase[plantIndex1];
-    const PlantData& plant2 = m_plantDatabase[plantIndex2];
-
-    // Recreate initial hazards with random plant data
-    m_hazards.push_back(new Hazard(
-        m_world,
-        b2Vec2(-15.0f, -2.0f),
-        1.0,
-        plant1.type,
-        plant1.name,
-        plant1.description,
-        plant1.imagePath
-        ));
-
-    m_hazards.push_back(new Hazard(
-        m_world,
-        b2Vec2(25.0f, 0.5f),
-        1.0,
-        plant2.type,
-        plant2.name,
-        plant2.description,
-        plant2.imagePath
-        ));
-
-    // Reset vehicle
-    m_vehicle->reset(b2Vec2(0.0f, 10.0f));
-}
-
-// Add this new method implementation after the constructor
-void PhysicsWorld::initializePlantDatabase()
-{
-    // Poisonous plants
-    m_plantDatabase.push_back({"poisonous", "Baneberry",
-                               "- Toxic parts: All parts, especially berries and leaves.\n"
-                               "- Effects: Nausea, vomiting, dizziness, abdominal pain, respiratory distress, and possible cardiac arrest.\n"
-                               "- Use: Not safe to consume.\n",
-                               ":/dangerous/Plants/Danger_Plants/baneberry.jpg"});
-
-    m_plantDatabase.push_back({"poisonous", "Death Camas",
-                               "- Toxic parts: Bulbs and leaves.\n"
-                               "- Effects: Vomiting, diarrhea, seizures, slow heart rate, and respiratory failure.\n"
-                               "- Use: Not safe to consume.\n"
-                               " Easily mistaken for edible wild onions, but highly toxic.\n",
-                               ":/dangerous/Plants/Danger_Plants/death_camas.jpg"});
-
-    m_plantDatabase.push_back({"poisonous", "Water Hemlock",
-                               "- Toxic parts: Roots, stems, and leaves.\n"
-                               "- Effects: Seizures, nausea, vomiting, respiratory paralysis, and death.\n"
-                               "- Use: Not safe under any circumstances.\n"
-                               " One of the most toxic plants in North America; even small amounts are lethal.\n",
-                               ":/dangerous/Plants/Danger_Plants/water_hemlock.jpg"});
-
-    m_plantDatabase.push_back({"poisonous", "Poison Ivy",
-                               "- Toxic parts: All parts contain urushiol oil.\n"
-                               "- Effects: Severe itching, rash, blisters, and allergic reactions upon contact.\n"
-                               "- Use: Not used medicinally; avoid skin contact.\n"
-                               " The oil can linger on clothing, tools, and pet fur.\n",
-                               ":/dangerous/Plants/Danger_Plants/poison_ivy.jpg"});
-
-    m_plantDatabase.push_back({"poisonous", "Jimson Weed",
-                               "- Toxic parts: Seeds and leaves.\n"
-                               "- Effects: Hallucinations, hyperthermia, dry mouth, delirium, heart arrhythmias, and death.\n"
-                               "- Use: Historically used in spiritual rituals, but extremely dangerous and not recommended.\n"
-                               " Contains potent tropane alkaloids such as atropine and scopolamine.\n",
-                               ":/dangerous/Plants/Danger_Plants/jimson_weed.jpg"});
-
-    m_plantDatabase.push_back({"poisonous", "Bittersweet Nightshade",
-                               "- Toxic parts: Berries, leaves, and stems.\n"
-                               "- Effects: Vomiting, diarrhea, slowed heartbeat, hallucinations, and paralysis.\n"
-                               "- Use: Historically used in folk remedies, but extremely unsafe and not recommended.\n",
-                               ":/dangerous/Plants/Danger_Plants/bittersweet_nightshade.jpg"});
-
-    m_plantDatabase.push_back({"poisonous", "False Hellebore",
-                               "- Toxic parts: All parts, especially roots and young shoots.\n"
-                               "- Effects: Nausea, vomiting, low blood pressure, slowed heart rate, and death.\n"
-                               "- Use: Not safe for any medicinal or nutritional purpose.\n"
-                               " Sometimes mistaken for edible wild leeks in early spring.\n",
-                               ":/dangerous/Plants/Danger_Plants/false_hellebore.jpg"});
-
-    m_plantDatabase.push_back({"poisonous", "Lupine/Blue Bonnet",
-                               "- Toxic parts: Seeds and young leaves.\n"
-                               "- Effects: Tremors, labored breathing, birth defects (in livestock), and possible death.\n"
-                               "- Use: Some species have historical medicinal use, but caution is strongly advised.\n"
-                               " Toxic alkaloids vary by species and region.\n",
-                               ":/dangerous/Plants/Danger_Plants/lupine_blue_bonnet.jpeg"});
-
-    m_plantDatabase.push_back({"poisonous", "Monkshood/Wolfbane",
-                               "- Toxic parts: All parts, especially roots and flowers.\n"
-                               "- Effects: Numbness, nausea, cardiac arrest, and death within hours.\n"
-                               "- Use: Occasionally used in ancient medicines, but highly lethal.\n"
-                               " Absorption through skin is possible — even small contact can be dangerous.\n",
-                               ":/dangerous/Plants/Danger_Plants/monkshood_wolfbane.jpg"});
-
-    m_plantDatabase.push_back({"poisonous", "Myrtle Spurge",
-                               "- Toxic parts: Milky sap from all parts.\n"
-                               "- Effects: Skin and eye irritation, nausea, vomiting, and blistering.\n"
-                               "- Use: No known safe uses; sap is highly caustic.\n"
-                               " Classified as a noxious weed in several states due to its spread and toxicity.\n",
-                               ":/dangerous/Plants/Danger_Plants/myrtle_spurge.jpg"});
-
-    m_plantDatabase.push_back({"poisonous", "Poison Hemlock",
-                               "- Toxic parts: All parts, especially roots and seeds.\n"
-                               "- Effects: Tremors, paralysis, respiratory failure, and death.\n"
-                               "- Use: Historically used as a sedative or poison, but fatally toxic.\n"
-                               " Easily mistaken for wild carrots or parsley.\n",
-                               ":/dangerous/Plants/Danger_Plants/poison_hemlock.jpg"});
-
-    m_plantDatabase.push_back({"poisonous", "Snow on the Mountain",
-                               "- Toxic parts: All parts, especially the milky sap.\n"
-                               "- Effects: Skin irritation, blisters, and eye damage if contact occurs.\n"
-                               "- Use: Not safe for internal or topical use.\n"
-                               " The sap is a strong irritant; protective gloves should be worn when handling.\n",
-                               ":/dangerous/Plants/Danger_Plants/snow_on_the_mountain.jpg"});
-
-    m_plantDatabase.push_back({"poisonous", "Stinging Nettle",
-                               "- Toxic parts: Tiny hairs on leaves and stems.\n"
-                               "- Effects: Burning, itching, rash, and temporary numbness upon contact.\n"
-                               "- Use: Despite irritation, leaves are edible when cooked and used for teas and soups.\n"
-                               " Cooking or drying neutralizes the stinging compounds.\n",
-                               ":/dangerous/Plants/Danger_Plants/stinging_nettle.jpg"});
-
-    m_plantDatabase.push_back({"poisonous", "Wart Weed",
-                               "- Toxic parts: Sap from leaves and stems.\n"
-                               "- Effects: Skin blistering, irritation, and eye damage upon contact.\n"
-                               "- Use: Historically applied to warts, but may cause more harm than benefit.\n"
-                               " Not recommended due to caustic nature of its sap.\n",
-                               ":/dangerous/Plants/Danger_Plants/wart_weed.jpg"});
-
-    m_plantDatabase.push_back({"poisonous", "Oregon Grape",
-                               "- Toxic parts: Roots and bark (in large amounts).\n"
-                               "- Effects: Can cause gastrointestinal upset in high doses.\n"
-                               "- Use: Root extracts sometimes used in herbal medicine for skin issues and digestion.\n"
-                               " Berries are edible but very tart; often used in jams when prepared properly.\n",
-                               ":/dangerous/Plants/Danger_Plants/oregon_grape.jpg"});
-
-    // Beneficial herbs
-    m_plantDatabase.push_back({"herb", "Creosote Bush",
-                               "- Affected parts: Leaves and stems.\n"
-                               "- Effects: May cause liver or kidney irritation in large amounts.\n"
-                               "- Use: Traditionally used to boost the immune system and reduce symptoms of infections.\n"
-                               " Has antimicrobial properties and was used by Indigenous peoples for colds and wounds.\n",
-                               ":/safe/Plants/Safe_Plants/creosote_bush.jpg"});
-
-    m_plantDatabase.push_back({"herb", "Golden Currant",
-                               "- Affected parts: Berries and leaves.\n"
-                               "- Effects: Non-toxic in moderate amounts.\n"
-                               "- Use: Rich in antioxidants and vitamins; berries eaten fresh or dried.\n"
-                               " Leaves brewed as tea to reduce inflammation and support immunity.\n",
-                               ":/safe/Plants/Safe_Plants/golden_currant.jpg"});
-
-    m_plantDatabase.push_back({"herb", "Mormon Tea",
-                               "- Affected parts: Stems.\n"
-                               "- Effects: Mild stimulant; can raise heart rate if consumed in large quantities.\n"
-                               "- Use: Used to stop bleeding, reduce fever, and treat digestive issues.\n"
-                               " Was historically brewed as tea.\n",
-                               ":/safe/Plants/Safe_Plants/mormon_tea.jpg"});
-
-    m_plantDatabase.push_back({"herb", "Osha",
-                               "- Affected parts: Root.\n"
-                               "- Effects: Generally safe in small doses.\n"
-                               "- Use: Used for respiratory issues, sleep aid, and inflammation.\n"
-                               " Often chewed or brewed into tea for sore throats and colds.\n"
-                               " Caution: Resembles Water Hemlock.",
-                               ":/safe/Plants/Safe_Plants/osha.jpg"});
-
-    m_plantDatabase.push_back({"herb", "Prairie Flax",
-                               "- Affected parts: Seeds and leaves.\n"
-                               "- Effects: Non-toxic; excessive seed intake may cause digestive discomfort.\n"
-                               "- Use: Seeds soothe digestion and freshen breath; leaves contain menthol to relieve nasal congestion.\n"
-                               " Sometimes used for mild respiratory relief.\n"
-                               " Caution: Resembles Lupine/Blue Bonnet.",
-                               ":/safe/Plants/Safe_Plants/prairie_flax.jpg"});
-
-    m_plantDatabase.push_back({"herb", "Prickly Pear Cactus",
-                               "- Affected parts: Pads and fruit.\n"
-                               "- Effects: Safe when de-spined and properly prepared.\n"
-                               "- Use: Eaten for fiber and antioxidants; used to regulate blood sugar and hydration.\n"
-                               " Pads and fruit are both edible and nutritionally beneficial.\n",
-                               ":/safe/Plants/Safe_Plants/prickly_pear_cactus.jpg"});
-
-    m_plantDatabase.push_back({"herb", "Sacred Thornapple",
-                               "- Affected parts: All parts, especially seeds and leaves.\n"
-                               "- Effects: Highly toxic; can cause hallucinations, dry mouth, rapid heartbeat, and death.\n"
-                               "- Use: Historically used in small doses as a sedative or in spiritual rituals.\n"
-                               " Use is extremely dangerous and not recommended.\n"
-                               " Caution: Resembles Jimson Weed.",
-                               ":/safe/Plants/Safe_Plants/sacred_thornapple.jpg"});
-
-    m_plantDatabase.push_back({"herb", "Sagebrush",
-                               "- Affected parts: Leaves and stems.\n"
-                               "- Effects: Generally non-toxic; may cause mild skin irritation or allergic reaction.\n"
-                               "- Use: Traditionally used in teas, smudging, and as a mild antiseptic.\n"
-                               " Seeds were used to make flour and the wood is highly flammable.\n",
-                               ":/safe/Plants/Safe_Plants/sagebrush.jpg"});
-
-    m_plantDatabase.push_back({"herb", "Snowberry",
-                               "- Affected parts: Berries.\n"
-                               "- Effects: Mildly toxic; may cause vomiting or dizziness if eaten in large amounts.\n"
-                               "- Use: Berries used externally to treat skin issues; bark and leaves used in traditional medicine.\n"
-                               " Often used as a poultice for cuts and burns.\n",
-                               ":/safe/Plants/Safe_Plants/snowberry.jpg"});
-
-    m_plantDatabase.push_back({"herb", "Utah Juniper",
-                               "- Affected parts: Berries and leaves.\n"
-                               "- Effects: May cause kidney irritation in large amounts.\n"
-                               "- Use: Berries used for treating colds and digestive issues; leaves used as poultice for wounds.\n"
-                               " Traditionally brewed as tea or burned for purification.\n",
-                               ":/safe/Plants/Safe_Plants/utah_juniper.jpg"});
-
-    m_plantDatabase.push_back({"herb", "Yarrow",
-                               "- Affected parts: Leaves and flowers.\n"
-                               "- Effects: Supports sweating for detox; calming effects may ease anxiety and depression; aids with allergies, digestion, hormone balance, circulation, and urinary health.\n"
-                               "- Use: Internally for fever, menstrual regulation, UTIs, and gastrointestinal relief. Externally to stop bleeding, speed wound healing, soothe bites, treat eczema, and repel insects.\n"
-                               " Caution: Resembles Poison Hemlock.",
-                               ":/safe/Plants/Safe_Plants/yarrow.jpg"});
+b2Body *PhysicsWorld::vehicleBody(int index) const {
+    return (index == 0) ? m_vehicle->getChassis() : m_vehicle->getWheel(index - 1);
+}
+
+void PhysicsWorld::saveState(SavedWorld &world, std::vector<SavedHazard> &hazards) const {
+    world.randomState = m_random.state();
+    world.stepCount = m_stepCount;
+    world.seed = m_seed;
+    world.roadPointCount = m_terrainProfile.vertexCount();
+    world.hazardCount = m_hazardCount;
+    world.unplacedHazardCount = m_unplacedHazardCount;
+    world.adaptiveTier = static_cast<int32_t>(m_adaptiveTier);
+    world.calmSteps = m_calmSteps;
+
+    for (int i = 0; i < SavedWorld::VehicleBodyCount; ++i) {
+        const b2Body *body = vehicleBody(i);
+        SavedBody &saved = world.vehicleBodies[i];
+        saved.positionX = body->GetPosition().x;
+        saved.positionY = body->GetPosition().y;
+        saved.angle = body->GetAngle();
+        saved.linearVelocityX = body->GetLinearVelocity().x;
+        saved.linearVelocityY = body->GetLinearVelocity().y;
+        saved.angularVelocity = body->GetAngularVelocity();
+        saved.awake = body->IsAwake() ? 1 : 0;
+    }
+    for (int i = 0; i < 2; ++i) {
+        world.wheelMotorSpeeds[i] = m_vehicle->getWheelJoint(i)->GetMotorSpeed();
+    }
+
+    // Walk the activation index so the hazards come out ordered by x; removed ones are skipped
+    hazards.clear();
+    hazards.reserve(m_hazards.size());
+    for (const HazardSlot &slot : m_hazardsByX) {
+        int index = m_hazards.indexOf(slot.handle);
+        if (index >= 0) {
+            const b2Vec2 &position = m_hazards.positions()[index];
+            hazards.push_back({position.x, position.y, m_hazards.radii()[index],
+                               m_hazards.plantIds()[index], static_cast<uint32_t>(m_hazards.kinds()[index])});
+        }
+    }
+}
+
+bool PhysicsWorld::validateState(const SavedWorld &world, const SavedHazard *hazards, uint32_t hazardCount) const {
+    // The road is fixed when the world is built
+    if (world.roadPointCount != m_terrainProfile.vertexCount()) {
+        return false;
+    }
+
+    // The hazard count sizes the regenerated level, so it must be one a level can have
+    if (world.hazardCount < 0 || world.hazardCount > MaxHazardCount ||
+        world.unplacedHazardCount < 0 || world.unplacedHazardCount > world.hazardCount ||
+        hazardCount > static_cast<uint32_t>(MaxHazardCount)) {
+        return false;
+    }
+
+    if (world.adaptiveTier < static_cast<int32_t>(PhysicsQuality::Low) ||
+        world.adaptiveTier > static_cast<int32_t>(PhysicsQuality::High) ||
+        world.calmSteps < 0 || world.calmSteps > CalmStepsBeforeDrop) {
+        return false;
+    }
+
+    for (int i = 0; i < SavedWorld::VehicleBodyCount; ++i) {
+        if (!isValidBody(world.vehicleBodies[i])) {
+            return false;
+        }
+    }
+    for (int i = 0; i < 2; ++i) {
+        if (!isWithin(world.wheelMotorSpeeds[i], MaxSavedSpeed)) {
+            return false;
+        }
+    }
+
+    // Reject plants the catalog does not know and sensors Box2D cannot build
+    const PlantCatalog &catalog = PlantCatalog::instance();
+    for (uint32_t i = 0; i < hazardCount; ++i) {
+        const SavedHazard &hazard = hazards[i];
+        int plantId = hazard.plantId;
+        if (plantId < 0 || plantId >= catalog.size() ||
+            hazard.kind != static_cast<uint32_t>(catalog.plant(plantId).kind)) {
+            return false;
+        }
+        if (!std::isfinite(hazard.radius) || hazard.radius <= 0.0f || hazard.radius > MaxSavedHazardRadius ||
+            !isWithin(hazard.positionX, MaxSavedCoordinate) || !isWithin(hazard.positionY, MaxSavedCoordinate)) {
+            return false;
+        }
+
+        // Hazards are re-added straight into the activation index, which is ordered by x
+        if (i > 0 && hazard.positionX < hazards[i - 1].positionX) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PhysicsWorld::loadState(const SavedWorld &world, const SavedHazard *hazards, uint32_t hazardCount) {
+    // Check everything before touching anything
+    if (!validateState(world, hazards, hazardCount)) {
+        return false;
+    }
+
+    // Generate the saved level so restarting it later works, then overwrite its live state
+    if (world.seed != m_seed || world.hazardCount != m_hazardCount) {
+        m_hazardCount = world.hazardCount;
+        generateLevel(world.seed);
+    }
+    releaseAllHazards();
+
+    m_hazardsByX.clear();
+    for (uint32_t i = 0; i < hazardCount; ++i) {
+        const SavedHazard &hazard = hazards[i];
+        addHazard(b2Vec2(hazard.positionX, hazard.positionY), hazard.radius,
+                  static_cast<PlantKind>(hazard.kind), hazard.plantId);
+    }
+    m_activeBegin = 0;
+    m_activeEnd = 0;
+
+    for (int i = 0; i < SavedWorld::VehicleBodyCount; ++i) {
+        b2Body *body = vehicleBody(i);
+        const SavedBody &saved = world.vehicleBodies[i];
+        body->SetTransform(b2Vec2(saved.positionX, saved.positionY), saved.angle);
+        body->SetLinearVelocity(b2Vec2(saved.linearVelocityX, saved.linearVelocityY));
+        body->SetAngularVelocity(saved.angularVelocity);
+        body->SetAwake(saved.awake != 0);
+    }
+    for (int i = 0; i < 2; ++i) {
+        m_vehicle->getWheelJoint(i)->SetMotorSpeed(world.wheelMotorSpeeds[i]);
+    }
+
+    m_random.setState(world.randomState);
+    m_unplacedHazardCount = world.unplacedHazardCount;
+    m_stepCount = world.stepCount;
+
+    // The adaptive mode carries on from the saved profile; fixed profiles ignore it
+    m_adaptiveTier = static_cast<PhysicsQuality>(world.adaptiveTier);
+    m_calmSteps = world.calmSteps;
+    if (m_quality == PhysicsQuality::Adaptive) {
+        m_solver = solverSettingsFor(m_adaptiveTier);
+    }
 
+    float vehicleX = m_vehicle->getChassis()->GetPosition().x;
+    m_terrain->update(vehicleX);
+    updateActiveRegion(vehicleX);
+    return true;
 }
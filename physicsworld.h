@@ -11,18 +11,85 @@
 #define PHYSICSWORLD_H
 
 #include "vehicle.h"
-#include "hazard.h"
+#include "contactevents.h"
+#include "hazardstore.h"
+#include "randomgenerator.h"
+#include "savestate.h"
+#include "terrain.h"
+#include "terrainprofile.h"
 #include <box2d/box2d.h>
+#include <memory>
 #include <vector>
 #include <QString>
 #include <QPair>
 
 
-struct PlantData {
-    QString type;         // "herb" or "poisonous"
-    QString name;         // Plant name
-    QString description;  // Plant description
-    QString imagePath;    // Path to plant image
+/**
+ * @brief Named physics quality profiles
+ */
+enum class PhysicsQuality {
+    Low,        // Fewer solver iterations, for weak machines
+    Default,    // The game's original settings
+    High,       // Two sub-steps and more iterations, for stable fast descents
+    Adaptive    // Picks Low, Default or High every step from the vehicle's speed and contacts
+};
+
+/**
+ * @brief Lower-case name of a quality profile, as shown to players and taken by simrunner
+ * @param quality Quality profile
+ * @return Name of the profile
+ */
+const char *toString(PhysicsQuality quality);
+
+/**
+ * @brief How each step of PhysicsWorld is solved
+ */
+struct SolverSettings {
+    int subSteps;               // Box2D steps per PhysicsWorld step, each a fraction of the time step
+    int velocityIterations;     // Velocity constraint solver iterations per sub-step
+    int positionIterations;     // Position constraint solver iterations per sub-step
+};
+
+/**
+ * @brief A spawned hazard's position along the road, for the activation window
+ */
+struct HazardSlot {
+    float x;                // World x coordinate of the hazard
+    HazardHandle handle;    // Handle of the hazard; stale once it has been removed
+};
+
+/**
+ * @brief Motion state of one body, as captured in a level snapshot
+ */
+struct BodySnapshot {
+    b2Vec2 position;
+    float angle;
+    b2Vec2 linearVelocity;
+    float angularVelocity;
+    bool awake;
+};
+
+/**
+ * @brief A hazard as it was when the level was generated
+ */
+struct HazardSnapshot {
+    b2Vec2 position;
+    float radius;
+    PlantKind kind;
+    int plantId;
+};
+
+/**
+ * @brief State of a freshly generated level, used to restart it without regenerating
+ */
+struct LevelSnapshot {
+    static const int VehicleBodyCount = 3;                  // Chassis and two wheels
+
+    BodySnapshot vehicleBodies[VehicleBodyCount];           // Chassis, then wheels 0 and 1
+    float wheelMotorSpeeds[2];                              // Motor speed of each wheel joint
+    std::vector<HazardSnapshot> hazards;                    // Every hazard, ordered by x
+    uint64_t randomState;                                   // Generator state after generation
+    int unplacedHazardCount;                                // Hazards the placement left out
 };
 
 /**
@@ -31,31 +98,153 @@ struct PlantData {
 class PhysicsWorld {
 
 private:
-    b2World m_world;                    // Box2D physics world
+    std::unique_ptr<b2World> m_world;   // Box2D physics world; replaced by rebuild()
+    unsigned int m_seed;                // Seed the level was generated from
+    RandomGenerator m_random;           // World-local generator for plant shuffles and placement
     float m_timeStep;                   // Simulation time step
-    int m_velocityIterations;           // Velocity constraint solver iterations
-    int m_positionIterations;           // Position constraint solver iterations
+    PhysicsQuality m_quality;           // Selected quality profile
+    SolverSettings m_solver;            // Settings the next step is solved with
+    PhysicsQuality m_adaptiveTier;      // Fixed profile the adaptive mode is currently on
+    int m_calmSteps;                    // Consecutive steps the adaptive mode could have stepped down
+    uint64_t m_stepCount;               // Steps taken since the world was built
 
+    TerrainProfile m_terrainProfile;        // Shape of the road, shared by physics, placement and rendering
     Vehicle *m_vehicle;                     // The player's controllable vehicle
-    std::vector<Hazard*> m_hazards;         // List of hazardous plants in the world
-    b2ContactListener* m_contactListener;   // Contact listener for collision detection
-    std::vector<b2Body*> m_removeQueue;     // Bodies queued for removal
-    std::vector<PlantData> m_plantDatabase; // Database of all plant information
+    Terrain *m_terrain;                     // Road bodies, streamed in chunks around the vehicle
+    HazardStore m_hazards;                  // Hazardous plants in the world, addressed by handle
+    std::vector<b2Body*> m_hazardBodyPool;  // Inactive sensor bodies of removed hazards, ready for reuse
+    int m_hazardCount;                      // Number of hazards requested for the level
+    std::vector<HazardSlot> m_hazardsByX;   // Spawned hazards ordered by x, for the activation window
+    int m_activeBegin;                      // First entry of m_hazardsByX inside the activation window
+    int m_activeEnd;                        // One past the last entry inside the activation window
+    float m_activationRadius;               // Half-width of the window of active bodies around the chassis
+    b2Body *m_leftWall;                     // Wall at the start of the road
+    b2Body *m_rightWall;                    // Wall at the end of the road, or at MaxPreciseX if endless
+    ContactEventBuffer m_contactEvents;     // Contacts recorded during the current step
+    ContactHandler* m_contactHandler;       // Game logic the step's contacts are handed to
+    std::vector<HazardHandle> m_removeQueue; // Hazards queued for removal
+    int m_unplacedHazardCount;              // Hazards the placement constraints left out
+    LevelSnapshot m_levelSnapshot;          // The current level as it was generated
 
+    /**
+     * @brief Fills the empty Box2D world with the vehicle, road, walls and hazards of the
+     *        level m_random is seeded for, and snapshots it
+     * @param vehicleSpec Vehicle to build
+     */
+    void buildLevel(const VehicleSpec &vehicleSpec);
 
+    /**
+     * @brief Generates a new level from a seed and snapshots it
+     * @param seed Seed for the level's random generation
+     */
+    void generateLevel(unsigned int seed);
+
+    /**
+     * @brief Records the freshly generated level in m_levelSnapshot
+     */
+    void captureLevelSnapshot();
+
+    /**
+     * @brief Returns every hazard body to the pool and empties the hazard store
+     */
+    void releaseAllHazards();
+
+    /**
+     * @brief Returns one of the vehicle's bodies in snapshot order
+     * @param index 0 for the chassis, 1 and 2 for the wheels
+     */
+    b2Body *vehicleBody(int index) const;
+
+    /**
+     * @brief Adds a hazard on a pooled body and appends it to the activation index.
+     *        Hazards must be added in ascending x.
+     * @param position Where the hazard sits
+     * @param radius Radius of the sensor
+     * @param kind Kind of plant
+     * @param plantId Plant catalog ID
+     */
+    void addHazard(const b2Vec2 &position, float radius, PlantKind kind, int plantId);
+
+    /**
+     * @brief Picks the adaptive mode's profile for the next step. Rises at once when the
+     *        vehicle speeds up or piles into contacts, and only drops back after a calm spell.
+     */
+    void adaptSolver();
+
+    /**
+     * @brief Holds the vehicle to the top speed a single full-length step allows, so
+     *        sub-stepped profiles drive like the default one
+     */
+    void limitVehicleSpeed();
+
+    /**
+     * @brief Puts the adaptive mode back on its starting profile, so a restarted level
+     *        steps exactly like a freshly generated one
+     */
+    void resetAdaptiveSolver();
+
+    /**
+     * @brief Scatters the level's hazards along the road using m_random
+     */
+    void spawnHazards();
+
+    /**
+     * @brief Activates the bodies within the activation radius of focusX and deactivates
+     *        the rest. The window only moves its ends, so the cost depends on how many
+     *        hazards enter or leave it, not on the size of the level.
+     * @param focusX World x coordinate the window is centred on
+     */
+    void updateActiveRegion(float focusX);
+
+    /**
+     * @brief Takes a sensor body from the pool and moves it into place, or creates one if
+     *        the pool is empty. The body is inactive until the activation window reaches it.
+     * @param position Where the hazard should sit
+     * @param radius Radius of the sensor
+     * @return Inactive sensor body
+     */
+    b2Body *acquireHazardBody(const b2Vec2 &position, float radius);
+
+    /**
+     * @brief Deactivates a removed hazard's body and returns it to the pool
+     * @param body Body that has been taken out of m_hazards
+     */
+    void releaseHazardBody(b2Body *body);
 
 public:
 
+    static const int DefaultRoadPointCount = 100;   // Road vertices in a regular level
+    static const int MaxHazardCount = 1000000;      // Most hazards a save-state may ask a level for
+    static constexpr float ArrivalThreshold = 5.0f; // How close the chassis must get to grandma's house
+
     /**
      * @brief Default constructor
      */
     PhysicsWorld();
 
     /**
-     * @brief Constructor that sets up world, vehicle, terrain, and hazards
+     * @brief Constructor that sets up world, vehicle, terrain, and hazards.
+     *        The same seed always produces the same terrain and hazard layout.
      * @param hazardCount Number of hazards to create in the world
+     * @param seed Seed for the level's random generation
+     * @param roadPointCount Number of road vertices, or TerrainProfile::Endless. Roads
+     *        longer than TerrainProfile::maxVertexCount() are cut, with a warning.
+     * @param vehicleSpec Definition of the player's vehicle; must be valid
+     */
+    PhysicsWorld(int hazardCount, unsigned int seed = randomSeed(), int roadPointCount = DefaultRoadPointCount,
+                 const VehicleSpec &vehicleSpec = VehicleSpec());
+
+    /**
+     * @brief Returns a fresh nondeterministic seed for when no seed is requested
+     * @return Random seed
      */
-    PhysicsWorld(int hazardCount);
+    static unsigned int randomSeed();
+
+    /**
+     * @brief Returns the seed this world was generated from
+     * @return Seed value
+     */
+    unsigned int seed() const { return m_seed; }
 
     /**
      * @brief Destructor cleans up dynamically allocated objects
@@ -67,6 +256,44 @@ public:
      */
     void step();
 
+    /**
+     * @brief Returns the fixed simulation time step
+     * @return Time step in seconds
+     */
+    float timeStep() const { return m_timeStep; }
+
+    /**
+     * @brief Returns the solver settings of one of the fixed quality profiles
+     * @param quality Low, Default or High
+     * @return Sub-steps and iterations for that profile
+     */
+    static SolverSettings solverSettingsFor(PhysicsQuality quality);
+
+    /**
+     * @brief Returns the selected quality profile
+     * @return Quality profile
+     */
+    PhysicsQuality quality() const { return m_quality; }
+
+    /**
+     * @brief Selects a quality profile. Must not be called during b2World::Step.
+     * @param quality Quality profile
+     */
+    void setQuality(PhysicsQuality quality);
+
+    /**
+     * @brief Returns the settings the next step will be solved with
+     * @return Sub-steps and iterations
+     */
+    const SolverSettings &solverSettings() const { return m_solver; }
+
+    /**
+     * @brief Returns how many steps have been taken since the world was built. Resets and
+     *        restarts do not rewind it, so it only ever counts up.
+     * @return Number of steps
+     */
+    uint64_t stepCount() const { return m_stepCount; }
+
     /**
      * @brief Returns a reference to the Box2D world
      * @return Reference to the Box2D world
@@ -80,37 +307,132 @@ public:
     Vehicle *getVehicle() const;
 
     /**
-     * @brief Returns the list of hazards
-     * @return Constant reference to the vector of hazards
+     * @brief Returns the road bodies currently streamed into the world
+     * @return Constant reference to the terrain
+     */
+    const Terrain &getTerrain() const { return *m_terrain; }
+
+    /**
+     * @brief Returns the shape of the road for height and slope queries
+     * @return Constant reference to the terrain profile
      */
-    const std::vector<Hazard*>& getHazards() const { return m_hazards; }
+    const TerrainProfile &getTerrainProfile() const { return m_terrainProfile; }
 
     /**
-     * @brief Sets the contact listener for collision detection
-     * @param listener Pointer to a b2ContactListener object
+     * @brief Returns the hazards in the world
+     * @return Constant reference to the hazard store
      */
-    void setContactListener(b2ContactListener* listener);
+    const HazardStore &getHazards() const { return m_hazards; }
 
     /**
-     * @brief Queues a hazard body for safe removal
-     * @param hazardBody Pointer to the Box2D body to remove
+     * @brief Returns how many requested hazards could not be placed on the road
+     * @return Number of hazards left out by the spacing and slope constraints
      */
-    void queueForRemoval(b2Body* hazardBody);
+    int unplacedHazardCount() const { return m_unplacedHazardCount; }
 
     /**
-     * @brief Processes the queue of bodies marked for removal
+     * @brief Returns the number of hazards requested for the level
+     * @return Requested hazard count
+     */
+    int hazardCount() const { return m_hazardCount; }
+
+    /**
+     * @brief Returns whether the vehicle has reached grandma's house at the end of the road
+     * @return True within ArrivalThreshold of the house; always false on an endless road
+     */
+    bool hasReachedEnd() const;
+
+    /**
+     * @brief Returns the half-width of the window of active bodies around the chassis
+     * @return Radius in meters
+     */
+    float activationRadius() const { return m_activationRadius; }
+
+    /**
+     * @brief Sets the half-width of the window of active bodies around the chassis.
+     *        Takes effect on the next step.
+     * @param radius Radius in meters
+     */
+    void setActivationRadius(float radius) { m_activationRadius = radius; }
+
+    /**
+     * @brief Sets the game logic that handles each step's contacts once the step is over.
+     *        The world takes ownership of the handler.
+     * @param handler Pointer to a ContactHandler object
+     */
+    void setContactHandler(ContactHandler* handler);
+
+    /**
+     * @brief Queues a hazard for safe removal. Queuing the same hazard twice is harmless.
+     * @param handle Handle of the hazard to remove
+     */
+    void queueForRemoval(HazardHandle handle);
+
+    /**
+     * @brief Removes every queued hazard. Each removal is O(1), so the whole queue is
+     *        drained at once. Must not be called during b2World::Step.
      */
     void processRemovalQueue();
 
     /**
-     * @brief Resets the physics world to initial state
+     * @brief Regenerates the level in place from a new seed. Hazard bodies are recycled
+     *        through the pool instead of being destroyed and recreated. Resetting to the
+     *        current seed restarts the level instead. Must not be called during b2World::Step.
+     * @param seed Seed for the level's random generation
+     */
+    void reset(unsigned int seed);
+
+    /**
+     * @brief Replaces the Box2D world with a new one and builds the level from a seed in it,
+     *        exactly as constructing a new PhysicsWorld with the same settings would. Slower
+     *        than reset(), but nothing from the old world's history remains, so recordings
+     *        start from here to replay identically in simrunner. Keeps the quality profile,
+     *        contact handler and step count. Must not be called during b2World::Step.
+     * @param seed Seed for the level's random generation
+     */
+    void rebuild(unsigned int seed);
+
+    /**
+     * @brief Puts the level back as it was generated: vehicle, wheel joints, hazards and
+     *        random generator. The vehicle's joint and contact impulses are cleared too,
+     *        so nothing from the last run warm-starts the solver. Only moves existing
+     *        bodies, so it is far cheaper than regenerating, but Box2D's internal order of
+     *        bodies, contacts and broad-phase proxies still depends on the world's
+     *        history: a restarted level plays like a freshly built one, not bit for bit.
+     *        Use rebuild() where it must match exactly. Must not be called during b2World::Step.
+     */
+    void restartLevel();
+
+    /**
+     * @brief Records the running simulation for a save-state. Box2D's contact and joint
+     *        warm-start impulses are not included; see savestate.h.
+     * @param world Receives the level identity, random generator, solver progress and vehicle state
+     * @param hazards Receives the hazards still in the world, ordered by x
+     */
+    void saveState(SavedWorld &world, std::vector<SavedHazard> &hazards) const;
+
+    /**
+     * @brief Checks that a save-state fits this world and holds only values Box2D can take.
+     *        Only reads state that is fixed when the world is built, so it may be called
+     *        while the world is stepping.
+     * @param world Level identity, random generator, solver progress and vehicle state
+     * @param hazards Hazards still in the world, ordered by x
+     * @param hazardCount Number of hazard records
+     * @return False if the save was made on a road of a different length or holds
+     *         unknown plants, counts out of range, non-finite or oversized values or
+     *         hazards out of x order
      */
-    void reset();
+    bool validateState(const SavedWorld &world, const SavedHazard *hazards, uint32_t hazardCount) const;
 
     /**
-     * @brief Initializes the plant database with information
+     * @brief Restores a save-state in place, regenerating the level first if it came from
+     *        another seed. Must not be called during b2World::Step.
+     * @param world Level identity, random generator, solver progress and vehicle state
+     * @param hazards Hazards still in the world, ordered by x
+     * @param hazardCount Number of hazard records
+     * @return False if validateState rejects the save; the world is left untouched then
      */
-    void initializePlantDatabase();
+    bool loadState(const SavedWorld &world, const SavedHazard *hazards, uint32_t hazardCount);
 };
 
 #endif // PHYSICSWORLD_H
@@ -0,0 +1,226 @@
+/**
+ * @file plantcatalog.cpp
+ * @brief Implementation of the PlantCatalog class
+ *
+ * @author Team AJKJ
+ */
+
+#include "plantcatalog.h"
+
+namespace {
+
+/**
+ * @brief One row of the compiled plant table
+ */
+struct PlantEntry {
+    PlantKind kind;
+    const char *name;
+    const char *description;
+    const char *imagePath;
+};
+
+// Every plant in the game. A plant's ID is its row number, so rows must only ever be appended.
+const PlantEntry PlantTable[] = {
+    // Poisonous plants
+    {PlantKind::Poisonous, "Baneberry",
+     "- Toxic parts: All parts, especially berries and leaves.\n"
+     "- Effects: Nausea, vomiting, dizziness, abdominal pain, respiratory distress, and possible cardiac arrest.\n"
+     "- Use: Not safe to consume.\n",
+     ":/dangerous/Plants/Danger_Plants/baneberry.jpg"},
+    {PlantKind::Poisonous, "Death Camas",
+     "- Toxic parts: Bulbs and leaves.\n"
+     "- Effects: Vomiting, diarrhea, seizures, slow heart rate, and respiratory failure.\n"
+     "- Use: Not safe to consume.\n"
+     " Easily mistaken for edible wild onions, but highly toxic.\n",
+     ":/dangerous/Plants/Danger_Plants/death_camas.jpg"},
+    {PlantKind::Poisonous, "Water Hemlock",
+     "- Toxic parts: Roots, stems, and leaves.\n"
+     "- Effects: Seizures, nausea, vomiting, respiratory paralysis, and death.\n"
+     "- Use: Not safe under any circumstances.\n"
+     " One of the most toxic plants in North America; even small amounts are lethal.\n",
+     ":/dangerous/Plants/Danger_Plants/water_hemlock.jpg"},
+    {PlantKind::Poisonous, "Poison Ivy",
+     "- Toxic parts: All parts contain urushiol oil.\n"
+     "- Effects: Severe itching, rash, blisters, and allergic reactions upon contact.\n"
+     "- Use: Not used medicinally; avoid skin contact.\n"
+     " The oil can linger on clothing, tools, and pet fur.\n",
+     ":/dangerous/Plants/Danger_Plants/poison_ivy.jpg"},
+    {PlantKind::Poisonous, "Jimson Weed",
+     "- Toxic parts: Seeds and leaves.\n"
+     "- Effects: Hallucinations, hyperthermia, dry mouth, delirium, heart arrhythmias, and death.\n"
+     "- Use: Historically used in spiritual rituals, but extremely dangerous and not recommended.\n"
+     " Contains potent tropane alkaloids such as atropine and scopolamine.\n",
+     ":/dangerous/Plants/Danger_Plants/jimson_weed.jpg"},
+    {PlantKind::Poisonous, "Bittersweet Nightshade",
+     "- Toxic parts: Berries, leaves, and stems.\n"
+     "- Effects: Vomiting, diarrhea, slowed heartbeat, hallucinations, and paralysis.\n"
+     "- Use: Historically used in folk remedies, but extremely unsafe and not recommended.\n",
+     ":/dangerous/Plants/Danger_Plants/bittersweet_nightshade.jpg"},
+    {PlantKind::Poisonous, "False Hellebore",
+     "- Toxic parts: All parts, especially roots and young shoots.\n"
+     "- Effects: Nausea, vomiting, low blood pressure, slowed heart rate, and death.\n"
+     "- Use: Not safe for any medicinal or nutritional purpose.\n"
+     " Sometimes mistaken for edible wild leeks in early spring.\n",
+     ":/dangerous/Plants/Danger_Plants/false_hellebore.jpg"},
+    {PlantKind::Poisonous, "Lupine/Blue Bonnet",
+     "- Toxic parts: Seeds and young leaves.\n"
+     "- Effects: Tremors, labored breathing, birth defects (in livestock), and possible death.\n"
+     "- Use: Some species have historical medicinal use, but caution is strongly advised.\n"
+     " Toxic alkaloids vary by species and region.\n",
+     ":/dangerous/Plants/Danger_Plants/lupine_blue_bonnet.jpeg"},
+    {PlantKind::Poisonous, "Monkshood/Wolfbane",
+     "- Toxic parts: All parts, especially roots and flowers.\n"
+     "- Effects: Numbness, nausea, cardiac arrest, and death within hours.\n"
+     "- Use: Occasionally used in ancient medicines, but highly lethal.\n"
+     " Absorption through skin is possible — even small contact can be dangerous.\n",
+     ":/dangerous/Plants/Danger_Plants/monkshood_wolfbane.jpg"},
+    {PlantKind::Poisonous, "Myrtle Spurge",
+     "- Toxic parts: Milky sap from all parts.\n"
+     "- Effects: Skin and eye irritation, nausea, vomiting, and blistering.\n"
+     "- Use: No known safe uses; sap is highly caustic.\n"
+     " Classified as a noxious weed in several states due to its spread and toxicity.\n",
+     ":/dangerous/Plants/Danger_Plants/myrtle_spurge.jpg"},
+    {PlantKind::Poisonous, "Poison Hemlock",
+     "- Toxic parts: All parts, especially roots and seeds.\n"
+     "- Effects: Tremors, paralysis, respiratory failure, and death.\n"
+     "- Use: Historically used as a sedative or poison, but fatally toxic.\n"
+     " Easily mistaken for wild carrots or parsley.\n",
+     ":/dangerous/Plants/Danger_Plants/poison_hemlock.jpg"},
+    {PlantKind::Poisonous, "Snow on the Mountain",
+     "- Toxic parts: All parts, especially the milky sap.\n"
+     "- Effects: Skin irritation, blisters, and eye damage if contact occurs.\n"
+     "- Use: Not safe for internal or topical use.\n"
+     " The sap is a strong irritant; protective gloves should be worn when handling.\n",
+     ":/dangerous/Plants/Danger_Plants/snow_on_the_mountain.jpg"},
+    {PlantKind::Poisonous, "Stinging Nettle",
+     "- Toxic parts: Tiny hairs on leaves and stems.\n"
+     "- Effects: Burning, itching, rash, and temporary numbness upon contact.\n"
+     "- Use: Despite irritation, leaves are edible when cooked and used for teas and soups.\n"
+     " Cooking or drying neutralizes the stinging compounds.\n",
+     ":/dangerous/Plants/Danger_Plants/stinging_nettle.jpg"},
+    {PlantKind::Poisonous, "Wart Weed",
+     "- Toxic parts: Sap from leaves and stems.\n"
+     "- Effects: Skin blistering, irritation, and eye damage upon contact.\n"
+     "- Use: Historically applied to warts, but may cause more harm than benefit.\n"
+     " Not recommended due to caustic nature of its sap.\n",
+     ":/dangerous/Plants/Danger_Plants/wart_weed.jpg"},
+    {PlantKind::Poisonous, "Oregon Grape",
+     "- Toxic parts: Roots and bark (in large amounts).\n"
+     "- Effects: Can cause gastrointestinal upset in high doses.\n"
+     "- Use: Root extracts sometimes used in herbal medicine for skin issues and digestion.\n"
+     " Berries are edible but very tart; often used in jams when prepared properly.\n",
+     ":/dangerous/Plants/Danger_Plants/oregon_grape.jpg"},
+
+    // Beneficial herbs
+    {PlantKind::Herb, "Creosote Bush",
+     "- Affected parts: Leaves and stems.\n"
+     "- Effects: May cause liver or kidney irritation in large amounts.\n"
+     "- Use: Traditionally used to boost the immune system and reduce symptoms of infections.\n"
+     " Has antimicrobial properties and was used by Indigenous peoples for colds and wounds.\n",
+     ":/safe/Plants/Safe_Plants/creosote_bush.jpg"},
+    {PlantKind::Herb, "Golden Currant",
+     "- Affected parts: Berries and leaves.\n"
+     "- Effects: Non-toxic in moderate amounts.\n"
+     "- Use: Rich in antioxidants and vitamins; berries eaten fresh or dried.\n"
+     " Leaves brewed as tea to reduce inflammation and support immunity.\n",
+     ":/safe/Plants/Safe_Plants/golden_currant.jpg"},
+    {PlantKind::Herb, "Mormon Tea",
+     "- Affected parts: Stems.\n"
+     "- Effects: Mild stimulant; can raise heart rate if consumed in large quantities.\n"
+     "- Use: Used to stop bleeding, reduce fever, and treat digestive issues.\n"
+     " Was historically brewed as tea.\n",
+     ":/safe/Plants/Safe_Plants/mormon_tea.jpg"},
+    {PlantKind::Herb, "Osha",
+     "- Affected parts: Root.\n"
+     "- Effects: Generally safe in small doses.\n"
+     "- Use: Used for respiratory issues, sleep aid, and inflammation.\n"
+     " Often chewed or brewed into tea for sore throats and colds.\n"
+     " Caution: Resembles Water Hemlock.",
+     ":/safe/Plants/Safe_Plants/osha.jpg"},
+    {PlantKind::Herb, "Prairie Flax",
+     "- Affected parts: Seeds and leaves.\n"
+     "- Effects: Non-toxic; excessive seed intake may cause digestive discomfort.\n"
+     "- Use: Seeds soothe digestion and freshen breath; leaves contain menthol to relieve nasal congestion.\n"
+     " Sometimes used for mild respiratory relief.\n"
+     " Caution: Resembles Lupine/Blue Bonnet.",
+     ":/safe/Plants/Safe_Plants/prairie_flax.jpg"},
+    {PlantKind::Herb, "Prickly Pear Cactus",
+     "- Affected parts: Pads and fruit.\n"
+     "- Effects: Safe when de-spined and properly prepared.\n"
+     "- Use: Eaten for fiber and antioxidants; used to regulate blood sugar and hydration.\n"
+     " Pads and fruit are both edible and nutritionally beneficial.\n",
+     ":/safe/Plants/Safe_Plants/prickly_pear_cactus.jpg"},
+    {PlantKind::Herb, "Sacred Thornapple",
+     "- Affected parts: All parts, especially seeds and leaves.\n"
+     "- Effects: Highly toxic; can cause hallucinations, dry mouth, rapid heartbeat, and death.\n"
+     "- Use: Historically used in small doses as a sedative or in spiritual rituals.\n"
+     " Use is extremely dangerous and not recommended.\n"
+     " Caution: Resembles Jimson Weed.",
+     ":/safe/Plants/Safe_Plants/sacred_thornapple.jpg"},
+    {PlantKind::Herb, "Sagebrush",
+     "- Affected parts: Leaves and stems.\n"
+     "- Effects: Generally non-toxic; may cause mild skin irritation or allergic reaction.\n"
+     "- Use: Traditionally used in teas, smudging, and as a mild antiseptic.\n"
+     " Seeds were used to make flour and the wood is highly flammable.\n",
+     ":/safe/Plants/Safe_Plants/sagebrush.jpg"},
+    {PlantKind::Herb, "Snowberry",
+     "- Affected parts: Berries.\n"
+     "- Effects: Mildly toxic; may cause vomiting or dizziness if eaten in large amounts.\n"
+     "- Use: Berries used externally to treat skin issues; bark and leaves used in traditional medicine.\n"
+     " Often used as a poultice for cuts and burns.\n",
+     ":/safe/Plants/Safe_Plants/snowberry.jpg"},
+    {PlantKind::Herb, "Utah Juniper",
+     "- Affected parts: Berries and leaves.\n"
+     "- Effects: May cause kidney irritation in large amounts.\n"
+     "- Use: Berries used for treating colds and digestive issues; leaves used as poultice for wounds.\n"
+     " Traditionally brewed as tea or burned for purification.\n",
+     ":/safe/Plants/Safe_Plants/utah_juniper.jpg"},
+    {PlantKind::Herb, "Yarrow",
+     "- Affected parts: Leaves and flowers.\n"
+     "- Effects: Supports sweating for detox; calming effects may ease anxiety and depression; aids with allergies, digestion, hormone balance, circulation, and urinary health.\n"
+     "- Use: Internally for fever, menstrual regulation, UTIs, and gastrointestinal relief. Externally to stop bleeding, speed wound healing, soothe bites, treat eczema, and repel insects.\n"
+     " Caution: Resembles Poison Hemlock.",
+     ":/safe/Plants/Safe_Plants/yarrow.jpg"},
+};
+
+} // namespace
+
+PlantCatalog::PlantCatalog()
+{
+    m_plants.reserve(sizeof(PlantTable) / sizeof(PlantTable[0]));
+    for (const PlantEntry &entry : PlantTable) {
+        int plantId = static_cast<int>(m_plants.size());
+        m_plants.push_back({entry.kind,
+                            QString::fromUtf8(entry.name),
+                            QString::fromUtf8(entry.description),
+                            QString::fromUtf8(entry.imagePath)});
+
+        if (entry.kind == PlantKind::Herb) {
+            m_herbIds.push_back(plantId);
+        } else {
+            m_poisonousIds.push_back(plantId);
+        }
+    }
+}
+
+const PlantCatalog &PlantCatalog::instance()
+{
+    // Function-local statics are initialized exactly once, even with several threads
+    static const PlantCatalog catalog;
+    return catalog;
+}
+
+const std::vector<int> &PlantCatalog::idsOfKind(PlantKind kind) const
+{
+    return kind == PlantKind::Herb ? m_herbIds : m_poisonousIds;
+}
+
+int PlantCatalog::idOf(const QString &name) const
+{
+    for (int plantId = 0; plantId < size(); ++plantId) {
+        if (m_plants[plantId].name == name) {
+            return plantId;
+        }
+    }
+    return -1;
+}
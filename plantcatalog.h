@@ -0,0 +1,91 @@
+/**
+ * @file plantcatalog.h
+ * @brief Defines the PlantCatalog that holds the information of every plant in the game
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef PLANTCATALOG_H
+#define PLANTCATALOG_H
+
+#include <QString>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Kind of plant a hazard represents
+ */
+enum class PlantKind : uint8_t {
+    Herb,       // Beneficial herb the player should collect
+    Poisonous   // Poisonous plant the player should avoid
+};
+
+/**
+ * @brief Information about one plant
+ */
+struct PlantData {
+    PlantKind kind;       // Herb or poisonous
+    QString name;         // Plant name
+    QString description;  // Plant description
+    QString imagePath;    // Path to plant image
+};
+
+/**
+ * @brief Read-only catalog of every plant in the game, shared by the whole process.
+ *
+ * The catalog is compiled into the program as a table and turned into PlantData once,
+ * on first use. Plants are identified by their integer ID, which is their position in
+ * the catalog, so lookups are plain array indexing.
+ */
+class PlantCatalog {
+
+private:
+
+    std::vector<PlantData> m_plants;        // Every plant, indexed by ID
+    std::vector<int> m_herbIds;             // IDs of the beneficial herbs
+    std::vector<int> m_poisonousIds;        // IDs of the poisonous plants
+
+    /**
+     * @brief Builds the catalog from the compiled plant table
+     */
+    PlantCatalog();
+
+public:
+
+    PlantCatalog(const PlantCatalog&) = delete;
+    PlantCatalog &operator=(const PlantCatalog&) = delete;
+
+    /**
+     * @brief Returns the process-wide catalog, building it on first use. Safe to call from any thread.
+     * @return Constant reference to the catalog
+     */
+    static const PlantCatalog &instance();
+
+    /**
+     * @brief Number of plants in the catalog
+     */
+    int size() const { return static_cast<int>(m_plants.size()); }
+
+    /**
+     * @brief Returns a plant by ID
+     * @param plantId ID between 0 and size() - 1
+     * @return Constant reference to the plant's data
+     */
+    const PlantData &plant(int plantId) const { return m_plants[plantId]; }
+
+    /**
+     * @brief Returns the IDs of every plant of one kind, in catalog order
+     * @param kind Kind of plant
+     * @return Constant reference to the list of IDs
+     */
+    const std::vector<int> &idsOfKind(PlantKind kind) const;
+
+    /**
+     * @brief Looks up a plant by name
+     * @param name Plant name as shown to the player
+     * @return The plant's ID, or -1 if no plant has that name
+     */
+    int idOf(const QString &name) const;
+};
+
+#endif // PLANTCATALOG_H
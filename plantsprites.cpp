@@ -0,0 +1,107 @@
+/**
+ * @file plantsprites.cpp
+ * @brief Implementation of the PlantSprites class
+ *
+ * @author Team AJKJ
+ */
+
+#include "plantsprites.h"
+#include <QPainterPath>
+#include <cmath>
+#include <random>
+#include <unordered_set>
+
+namespace {
+
+// Bounds of the blades around the root in meters, pen width included. Blades reach half
+// the spread either side and at most 1.9 m up, which is screen-down.
+const float SpriteLeft = 0.65f;         // Sprite edge left of the root
+const float SpriteWidth = 1.3f;
+const float SpriteTop = 0.05f;          // Sprite edge above the root
+const float SpriteHeight = 2.0f;
+
+} // namespace
+
+PlantSprites::PlantSprites() : m_scale(0.0f), m_devicePixelRatio(0.0) {}
+
+uint64_t PlantSprites::seedKey(const b2Vec2 &position)
+{
+    uint32_t x = static_cast<uint32_t>(static_cast<int>(position.x * 1000));
+    uint32_t y = static_cast<uint32_t>(static_cast<int>(position.y * 1000));
+    return (static_cast<uint64_t>(x) << 32) | y;
+}
+
+void PlantSprites::setResolution(float scale, qreal devicePixelRatio)
+{
+    if (scale == m_scale && devicePixelRatio == m_devicePixelRatio) {
+        return;
+    }
+    m_sprites.clear();
+    m_scale = scale;
+    m_devicePixelRatio = devicePixelRatio;
+}
+
+void PlantSprites::retain(const std::vector<b2Vec2> &positions)
+{
+    std::unordered_set<uint64_t> keep;
+    for (const b2Vec2 &position : positions) {
+        keep.insert(seedKey(position));
+    }
+    for (auto it = m_sprites.begin(); it != m_sprites.end();) {
+        if (keep.count(it->first)) {
+            ++it;
+        } else {
+            it = m_sprites.erase(it);
+        }
+    }
+}
+
+QPixmap PlantSprites::drawSprite(const b2Vec2 &position) const
+{
+    QPixmap sprite(static_cast<int>(std::ceil(SpriteWidth * m_scale * m_devicePixelRatio)),
+                   static_cast<int>(std::ceil(SpriteHeight * m_scale * m_devicePixelRatio)));
+    sprite.setDevicePixelRatio(m_devicePixelRatio);
+    sprite.fill(Qt::transparent);
+
+    QPainter painter(&sprite);
+    painter.scale(m_scale, m_scale);
+    painter.translate(SpriteLeft, SpriteTop);
+
+    // Use position-based seed for deterministic randomness
+    std::seed_seq seed{static_cast<int>(position.x * 1000), static_cast<int>(position.y * 1000)};
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> greenOffset(0, 80);
+    std::uniform_real_distribution<float> ctrlOffset(-0.25f, 0.25f);
+    std::uniform_real_distribution<float> tipJitter(0.0f, 0.3f);
+
+    // Set pen color and thickness for plant
+    int green = 130 + static_cast<int>(greenOffset(rng));
+    painter.setPen(QPen(QColor(0, green, 0), 0.05));
+
+    // Plant configuration
+    int bladeCount = 13;
+    float baseSpread = 0.1f;
+    float bladeHeight = 1.6f;
+
+    for (int i = -bladeCount / 2; i <= bladeCount / 2; ++i) {
+        float offsetX = i * baseSpread;
+        float ctrlX = offsetX * 0.5f + ctrlOffset(rng);
+        float tipY = bladeHeight + tipJitter(rng);
+
+        QPainterPath blade;
+        blade.moveTo(offsetX, 0.0f);
+        blade.quadTo(ctrlX, tipY * 0.5f, 0.0f, tipY);
+        painter.drawPath(blade);
+    }
+    return sprite;
+}
+
+void PlantSprites::draw(QPainter &painter, const QPointF &screenPos, const b2Vec2 &position)
+{
+    uint64_t key = seedKey(position);
+    auto it = m_sprites.find(key);
+    if (it == m_sprites.end()) {
+        it = m_sprites.emplace(key, drawSprite(position)).first;
+    }
+    painter.drawPixmap(screenPos - QPointF(SpriteLeft * m_scale, SpriteTop * m_scale), it->second);
+}
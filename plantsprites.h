@@ -0,0 +1,75 @@
+/**
+ * @file plantsprites.h
+ * @brief Defines the PlantSprites class that caches each plant's drawing as a pixmap
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef PLANTSPRITES_H
+#define PLANTSPRITES_H
+
+#include <box2d/box2d.h>
+#include <QPainter>
+#include <QPixmap>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Plant drawings rasterised once and blitted every frame.
+ *
+ * A plant's blades are random, but seeded from its position, so the same plant always
+ * looks the same. Each plant is therefore drawn into a transparent pixmap the first time
+ * it is shown, at the current pixels per meter and device pixel ratio, and that pixmap is
+ * reused until either of them changes.
+ */
+class PlantSprites {
+
+private:
+
+    float m_scale;                                      // Pixels per meter the sprites were drawn at
+    qreal m_devicePixelRatio;                           // Device pixel ratio the sprites were drawn at
+    std::unordered_map<uint64_t, QPixmap> m_sprites;    // Drawn sprites by plant seed
+
+    /**
+     * @brief Packs the seed a plant's blades are generated from into a cache key
+     * @param position Plant root in world coordinates
+     */
+    static uint64_t seedKey(const b2Vec2 &position);
+
+    /**
+     * @brief Draws one plant into a new sprite at the current resolution
+     * @param position Plant root in world coordinates
+     */
+    QPixmap drawSprite(const b2Vec2 &position) const;
+
+public:
+
+    /**
+     * @brief Constructor. No sprites are drawn until a resolution is set.
+     */
+    PlantSprites();
+
+    /**
+     * @brief Sets the resolution sprites are drawn at, dropping every sprite if it changed
+     * @param scale Pixels per meter
+     * @param devicePixelRatio Device pixel ratio of the widget painted on
+     */
+    void setResolution(float scale, qreal devicePixelRatio);
+
+    /**
+     * @brief Drops the sprites of plants that are no longer in the level
+     * @param positions Roots of every plant that may still be drawn
+     */
+    void retain(const std::vector<b2Vec2> &positions);
+
+    /**
+     * @brief Blits a plant, drawing its sprite first if it is not cached yet
+     * @param painter Painter with no transform, drawing in widget coordinates
+     * @param screenPos Plant root on screen
+     * @param position Plant root in world coordinates
+     */
+    void draw(QPainter &painter, const QPointF &screenPos, const b2Vec2 &position);
+};
+
+#endif // PLANTSPRITES_H
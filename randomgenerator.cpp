@@ -0,0 +1,31 @@
+/**
+ * @file randomgenerator.cpp
+ * @brief Implementation of the RandomGenerator class
+ *
+ * @author Team AJKJ
+ */
+
+#include "randomgenerator.h"
+
+RandomGenerator::RandomGenerator(uint64_t seed) : m_state(seed) { }
+
+uint32_t RandomGenerator::next()
+{
+    // SplitMix64 step, keeping the high half of the mixed output
+    uint64_t z = (m_state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    return static_cast<uint32_t>(z >> 32);
+}
+
+int RandomGenerator::nextInt(int bound)
+{
+    // Multiply-shift maps 32 random bits onto [0, bound) without a modulo
+    return static_cast<int>((static_cast<uint64_t>(next()) * static_cast<uint32_t>(bound)) >> 32);
+}
+
+double RandomGenerator::nextDouble()
+{
+    return (next() + 0.5) / 4294967296.0;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file randomgenerator.h
+ * @brief Defines the RandomGenerator class, a small seedable pseudo-random number generator
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef RANDOMGENERATOR_H
+#define RANDOMGENERATOR_H
+
+#include <cstdint>
+
+/**
+ * @brief SplitMix64 pseudo-random number generator.
+ *
+ * Each world owns one, so world generation never touches global rand() state and the same
+ * seed gives the same sequence on every platform and compiler. The whole state is a single
+ * 64-bit integer, which keeps it trivial to copy or save.
+ */
+class RandomGenerator {
+
+private:
+
+    uint64_t m_state;   // Current generator state
+
+public:
+
+    /**
+     * @brief Constructor
+     * @param seed Seed for the sequence
+     */
+    explicit RandomGenerator(uint64_t seed = 0);
+
+    /**
+     * @brief Returns the next 32 random bits
+     */
+    uint32_t next();
+
+    /**
+     * @brief Returns a random integer in [0, bound)
+     * @param bound Exclusive upper bound, must be positive
+     */
+    int nextInt(int bound);
+
+    /**
+     * @brief Returns a random number in the open interval (0, 1)
+     */
+    double nextDouble();
+
+    /**
+     * @brief Returns the generator state, for saving and restoring a sequence position
+     */
+    uint64_t state() const { return m_state; }
+
+    /**
+     * @brief Restores a state previously returned by state()
+     * @param state Generator state
+     */
+    void setState(uint64_t state) { m_state = state; }
+};
+
+#endif // RANDOMGENERATOR_H
@@ -0,0 +1,97 @@
+/**
+ * @file rendersnapshot.h
+ * @brief Defines the RenderSnapshot published after every physics step and the lock-free
+ *        SnapshotBuffer that hands snapshots from the physics thread to the GUI thread
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef RENDERSNAPSHOT_H
+#define RENDERSNAPSHOT_H
+
+#include "plantcatalog.h"
+#include <box2d/box2d.h>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Position and angle of a body at the end of a physics step
+ */
+struct BodyState {
+    b2Vec2 position;
+    float angle;
+};
+
+/**
+ * @brief Everything the renderer needs from the simulation after one step
+ */
+struct RenderSnapshot {
+    static const int VehicleBodyCount = 3;              // Chassis followed by both wheels
+
+    BodyState previousVehicle[VehicleBodyCount];        // Vehicle body states before the step
+    BodyState vehicle[VehicleBodyCount];                // Vehicle body states after the step
+    std::vector<b2Vec2> hazardPositions;                // Hazards still in the world
+    std::vector<PlantKind> hazardKinds;                 // Kind of each hazard, parallel to hazardPositions
+    uint64_t hazardVersion = UINT64_MAX;                // HazardStore::version() the hazard arrays were copied at
+    uint64_t step = 0;                                  // World step count after the step
+    int64_t publishedNs = 0;                            // Steady-clock time the step was published
+};
+
+/**
+ * @brief Triple buffer with one writer and one reader that never wait for each other.
+ *
+ * The writer fills back() and publishes it; the reader picks up the newest published buffer
+ * with acquire() and reads front(). A third buffer sits between them, so a slow reader never
+ * holds up the writer and a fast writer never overwrites what the reader is looking at. Only
+ * one index is shared, swapped atomically.
+ */
+template <typename T>
+class SnapshotBuffer {
+
+private:
+
+    static const int IndexMask = 3;
+    static const int FreshBit = 4;          // Set on the shared index when it holds an unread publish
+
+    T m_buffers[3];
+    std::atomic<int> m_shared;              // Buffer between writer and reader, plus FreshBit
+    int m_back;                             // Buffer the writer fills; writer only
+    int m_front;                            // Buffer the reader reads; reader only
+
+public:
+
+    SnapshotBuffer() : m_shared(1), m_back(0), m_front(2) { }
+
+    /**
+     * @brief Buffer to fill for the next publish. Writer only.
+     */
+    T &back() { return m_buffers[m_back]; }
+
+    /**
+     * @brief Hands the filled back buffer to the reader and takes a free one in its place.
+     *        Writer only.
+     */
+    void publish() {
+        m_back = m_shared.exchange(m_back | FreshBit, std::memory_order_acq_rel) & IndexMask;
+    }
+
+    /**
+     * @brief Switches front() to the newest published buffer, if there is one. Reader only.
+     * @return True if front() changed
+     */
+    bool acquire() {
+        if (!(m_shared.load(std::memory_order_relaxed) & FreshBit)) {
+            return false;
+        }
+        m_front = m_shared.exchange(m_front, std::memory_order_acq_rel) & IndexMask;
+        return true;
+    }
+
+    /**
+     * @brief Buffer the reader last acquired. Reader only.
+     */
+    const T &front() const { return m_buffers[m_front]; }
+};
+
+#endif // RENDERSNAPSHOT_H
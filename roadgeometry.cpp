@@ -0,0 +1,81 @@
+/**
+ * @file roadgeometry.cpp
+ * @brief Implementation of the RoadGeometry class
+ *
+ * @author Team AJKJ
+ */
+
+#include "roadgeometry.h"
+#include <algorithm>
+
+RoadGeometry::RoadGeometry(const TerrainProfile *profile) : m_profile(profile) {
+    if (m_profile->isEndless()) {
+        return;
+    }
+
+    // A regular road is short enough to keep whole
+    int tileCount = (m_profile->vertexCount() - 2) / SegmentsPerTile + 1;
+    for (int i = 0; i < tileCount; ++i) {
+        m_tiles.push_back(buildTile(i));
+    }
+}
+
+RoadGeometry::Tile RoadGeometry::buildTile(int index) const
+{
+    int firstVertex = index * SegmentsPerTile;
+    int lastVertex = firstVertex + SegmentsPerTile;
+    if (!m_profile->isEndless()) {
+        lastVertex = std::min(lastVertex, m_profile->vertexCount() - 1);
+    }
+
+    Tile tile;
+    tile.index = index;
+    float lowest = m_profile->vertexHeight(firstVertex);
+    tile.fill.moveTo(m_profile->vertexX(firstVertex), m_profile->vertexHeight(firstVertex));
+    for (int i = firstVertex + 1; i <= lastVertex; ++i) {
+        tile.fill.lineTo(m_profile->vertexX(i), m_profile->vertexHeight(i));
+        lowest = std::min(lowest, m_profile->vertexHeight(i));
+    }
+
+    // Close the tile well below the road so the ground reaches past the bottom of the view
+    float bottom = lowest - FillDepth;
+    tile.fill.lineTo(m_profile->vertexX(lastVertex), bottom);
+    tile.fill.lineTo(m_profile->vertexX(firstVertex), bottom);
+    tile.fill.closeSubpath();
+    return tile;
+}
+
+void RoadGeometry::cacheTiles(int firstTile, int lastTile)
+{
+    // Drop tiles that have left the range, then build the ones that have entered it
+    while (!m_tiles.empty() && m_tiles.front().index < firstTile) {
+        m_tiles.pop_front();
+    }
+    while (!m_tiles.empty() && m_tiles.back().index > lastTile) {
+        m_tiles.pop_back();
+    }
+    if (m_tiles.empty()) {
+        m_tiles.push_back(buildTile(firstTile));
+    }
+    while (m_tiles.front().index > firstTile) {
+        m_tiles.push_front(buildTile(m_tiles.front().index - 1));
+    }
+    while (m_tiles.back().index < lastTile) {
+        m_tiles.push_back(buildTile(m_tiles.back().index + 1));
+    }
+}
+
+void RoadGeometry::draw(QPainter &painter, float minX, float maxX)
+{
+    int firstTile = m_profile->segmentIndexAt(minX) / SegmentsPerTile;
+    int lastTile = m_profile->segmentIndexAt(maxX) / SegmentsPerTile;
+    if (m_profile->isEndless()) {
+        cacheTiles(firstTile, lastTile);
+    }
+
+    // Tiles are contiguous from the front tile's index
+    int offset = m_tiles.front().index;
+    for (int i = firstTile; i <= lastTile; ++i) {
+        painter.drawPath(m_tiles[i - offset].fill);
+    }
+}
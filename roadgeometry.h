@@ -0,0 +1,72 @@
+/**
+ * @file roadgeometry.h
+ * @brief Defines the RoadGeometry class that caches the road's filled outline for drawing
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef ROADGEOMETRY_H
+#define ROADGEOMETRY_H
+
+#include "terrainprofile.h"
+#include <QPainter>
+#include <QPainterPath>
+#include <deque>
+
+/**
+ * @brief The road's filled polygon in world coordinates, built once and drawn through the
+ * painter's camera transform.
+ *
+ * The road is split into tiles of a fixed number of segments, each one closed path from
+ * the road surface down to well below its lowest vertex. A regular road is built in full
+ * when the renderer is created. An endless road builds tiles as the camera reaches them
+ * and drops the ones it has left behind, like Terrain does with its chunks.
+ */
+class RoadGeometry {
+
+private:
+
+    /**
+     * @brief One cached run of road
+     */
+    struct Tile {
+        int index;              // Tile number along the road
+        QPainterPath fill;      // Road surface and the ground below it, in world coordinates
+    };
+
+    static const int SegmentsPerTile = 16;          // Road segments in one tile
+    static constexpr float FillDepth = 200.0f;      // How far below a tile's lowest vertex its fill reaches
+
+    const TerrainProfile *m_profile;    // Road shape; not owned
+    std::deque<Tile> m_tiles;           // Cached tiles, contiguous and ordered by index
+
+    /**
+     * @brief Builds the fill path of one tile
+     * @param index Tile number along the road
+     */
+    Tile buildTile(int index) const;
+
+    /**
+     * @brief Makes the cached tiles cover exactly the given range (endless roads only)
+     */
+    void cacheTiles(int firstTile, int lastTile);
+
+public:
+
+    /**
+     * @brief Constructor builds every tile of a regular road
+     * @param profile Shape of the road; must outlive the geometry
+     */
+    explicit RoadGeometry(const TerrainProfile *profile);
+
+    /**
+     * @brief Fills the road between two world x coordinates. The painter's transform must
+     *        map world coordinates to the screen.
+     * @param painter Painter with the camera transform, brush and pen already set
+     * @param minX Left edge of the view in world coordinates
+     * @param maxX Right edge of the view in world coordinates
+     */
+    void draw(QPainter &painter, float minX, float maxX);
+};
+
+#endif // ROADGEOMETRY_H
@@ -0,0 +1,124 @@
+/**
+ * @file savestate.cpp
+ * @brief Implementation of the SaveState class
+ *
+ * @author Team AJKJ
+ */
+
+#include "savestate.h"
+#include "gamemanager.h"
+#include "physicsworld.h"
+#include <QSaveFile>
+#include <cstring>
+
+namespace {
+
+/**
+ * @brief Checks that saved game progress names a real state and level, and that a level
+ *        state is on the level it names
+ */
+bool isValidProgress(const SavedProgress &progress)
+{
+    if (progress.gameState < MainMenu || progress.gameState > GameClear ||
+        progress.level < 1 || progress.level > GameManager::LevelCount ||
+        progress.trackedPlantCount < 0 || progress.trackedPlantCount > SavedProgress::MaxTrackedPlants) {
+        return false;
+    }
+    bool inLevel = progress.gameState >= Level1 && progress.gameState <= Level3;
+    return !inLevel || progress.gameState - Level1 + 1 == progress.level;
+}
+
+} // namespace
+
+SaveState::SaveState() : m_data(nullptr),
+                         m_header(nullptr),
+                         m_hazards(nullptr) { }
+
+SaveState::~SaveState()
+{
+    close();
+}
+
+bool SaveState::write(const QString &path, const PhysicsWorld &world, const SavedProgress &progress)
+{
+    SaveStateHeader header;
+    std::memset(&header, 0, sizeof(header)); // Keep padding bytes deterministic
+    header.magic = SaveStateHeader::Magic;
+    header.version = SaveStateHeader::CurrentVersion;
+    header.byteOrder = SaveStateHeader::ByteOrderMark;
+    header.progress = progress;
+
+    std::vector<SavedHazard> hazards;
+    world.saveState(header.world, hazards);
+    header.hazardCount = static_cast<uint32_t>(hazards.size());
+
+    // Lay the file out in memory and write it in one go
+    size_t hazardBytes = hazards.size() * sizeof(SavedHazard);
+    std::vector<char> buffer(sizeof(header) + hazardBytes);
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    if (hazardBytes > 0) {
+        std::memcpy(buffer.data() + sizeof(header), hazards.data(), hazardBytes);
+    }
+
+    // QSaveFile only replaces the old save once the new one is complete
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    if (file.write(buffer.data(), static_cast<qint64>(buffer.size())) != static_cast<qint64>(buffer.size())) {
+        file.cancelWriting();
+        return false;
+    }
+    return file.commit();
+}
+
+bool SaveState::open(const QString &path)
+{
+    close();
+
+    m_file.setFileName(path);
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    qint64 size = m_file.size();
+    if (size < static_cast<qint64>(sizeof(SaveStateHeader))) {
+        close();
+        return false;
+    }
+
+    m_data = m_file.map(0, size);
+    if (!m_data) {
+        close();
+        return false;
+    }
+
+    // The mapping is page-aligned, so the records can be read in place
+    const SaveStateHeader *header = reinterpret_cast<const SaveStateHeader*>(m_data);
+    qint64 expectedSize = static_cast<qint64>(sizeof(SaveStateHeader))
+                          + static_cast<qint64>(header->hazardCount) * static_cast<qint64>(sizeof(SavedHazard));
+    if (header->magic != SaveStateHeader::Magic || header->version != SaveStateHeader::CurrentVersion ||
+        header->byteOrder != SaveStateHeader::ByteOrderMark || size != expectedSize ||
+        !isValidProgress(header->progress) ||
+        header->world.hazardCount < 0 || header->world.hazardCount > PhysicsWorld::MaxHazardCount) {
+        close();
+        return false;
+    }
+
+    m_header = header;
+    m_hazards = reinterpret_cast<const SavedHazard*>(m_data + sizeof(SaveStateHeader));
+    return true;
+}
+
+void SaveState::close()
+{
+    if (m_data) {
+        m_file.unmap(m_data);
+        m_data = nullptr;
+    }
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+    m_header = nullptr;
+    m_hazards = nullptr;
+}
@@ -0,0 +1,178 @@
+/**
+ * @file savestate.h
+ * @brief Defines the binary save-state format and the SaveState file reader/writer
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef SAVESTATE_H
+#define SAVESTATE_H
+
+#include <QFile>
+#include <QString>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+class PhysicsWorld;
+
+// A save-state file is one SaveStateHeader followed by header.hazardCount SavedHazard
+// records. Every record is plain fixed-size data in native byte order, so a mapped file
+// is read in place without parsing. All records are multiples of 4 bytes and the header
+// is a multiple of 8, so the hazard array stays aligned.
+//
+// A save holds everything the game itself keeps: level, hazards, vehicle motion, random
+// generator, step count and adaptive solver profile. Box2D's solver caches are not in it:
+// contacts and their warm-start impulses, and the wheel joints' accumulated impulses.
+// Box2D rebuilds those within a few steps of loading, so a loaded run plays the same but
+// is not bit-identical to the run that was saved. Recordings, which replay from the
+// level's start, are the exact reproduction.
+
+/**
+ * @brief Motion state of one body
+ */
+struct SavedBody {
+    float positionX;
+    float positionY;
+    float angle;
+    float linearVelocityX;
+    float linearVelocityY;
+    float angularVelocity;
+    uint32_t awake;
+};
+
+/**
+ * @brief A hazard still in the world
+ */
+struct SavedHazard {
+    float positionX;
+    float positionY;
+    float radius;
+    int32_t plantId;
+    uint32_t kind;          // PlantKind
+};
+
+/**
+ * @brief Collection progress for one plant the level asks for
+ */
+struct SavedPlantProgress {
+    int32_t plantId;
+    int32_t collected;
+    int32_t total;
+};
+
+/**
+ * @brief GameManager counters
+ */
+struct SavedProgress {
+    static const int MaxTrackedPlants = 8;
+
+    int32_t gameState;                              // GameState
+    int32_t level;
+    int32_t score;
+    int32_t health;
+    int32_t poisonousCollected;
+    int32_t trackedPlantCount;                      // Used entries of trackedPlants
+    SavedPlantProgress trackedPlants[MaxTrackedPlants];
+};
+
+/**
+ * @brief PhysicsWorld state: level identity, random generator, solver progress and vehicle
+ */
+struct SavedWorld {
+    static const int VehicleBodyCount = 3;
+
+    uint64_t randomState;                           // World generator state
+    uint64_t stepCount;                             // Steps the world had taken
+    uint32_t seed;                                  // Seed the level was generated from
+    int32_t roadPointCount;                         // Road vertices, or TerrainProfile::Endless
+    int32_t hazardCount;                            // Hazards requested for the level
+    int32_t unplacedHazardCount;
+    int32_t adaptiveTier;                           // PhysicsQuality the adaptive mode was on
+    int32_t calmSteps;                              // Steps the adaptive mode had been calm for
+    SavedBody vehicleBodies[VehicleBodyCount];      // Chassis, then wheels 0 and 1
+    float wheelMotorSpeeds[2];
+};
+
+/**
+ * @brief Start of a save-state file
+ */
+struct SaveStateHeader {
+    static const uint32_t Magic = 0x53475353;       // "SSGS" read as little-endian
+    static const uint32_t CurrentVersion = 2;
+    static const uint32_t ByteOrderMark = 0x01020304;
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t byteOrder;                             // Detects files from a machine of the other endianness
+    uint32_t hazardCount;                           // SavedHazard records after the header
+    SavedWorld world;
+    SavedProgress progress;
+};
+
+static_assert(std::is_trivially_copyable<SaveStateHeader>::value, "Save-state records must be plain data");
+static_assert(std::is_trivially_copyable<SavedHazard>::value, "Save-state records must be plain data");
+static_assert(sizeof(SaveStateHeader) % 8 == 0, "Hazard records must start aligned");
+static_assert(sizeof(SavedHazard) % 4 == 0, "Hazard records must stay aligned");
+
+/**
+ * @brief Writes and memory-maps save-state files.
+ *
+ * Saving copies the header and hazard records into one buffer and writes it with a
+ * single call. Loading maps the file and points straight into it, so opening a save is
+ * a size check and a few comparisons however many hazards it holds.
+ */
+class SaveState {
+
+private:
+
+    QFile m_file;                       // Mapped file; must stay open while mapped
+    uchar *m_data;                      // Start of the mapping, or nullptr
+    const SaveStateHeader *m_header;    // Header inside the mapping
+    const SavedHazard *m_hazards;       // Hazard records inside the mapping
+
+public:
+
+    SaveState();
+
+    /**
+     * @brief Destructor unmaps the file
+     */
+    ~SaveState();
+
+    SaveState(const SaveState&) = delete;
+    SaveState &operator=(const SaveState&) = delete;
+
+    /**
+     * @brief Writes a save-state file
+     * @param path File to write
+     * @param world World to save
+     * @param progress Game progress to save alongside it
+     * @return True if the whole file was written
+     */
+    static bool write(const QString &path, const PhysicsWorld &world, const SavedProgress &progress);
+
+    /**
+     * @brief Maps a save-state file and checks that it is complete and readable on this machine
+     * @param path File to open
+     * @return True if the save can be used
+     */
+    bool open(const QString &path);
+
+    /**
+     * @brief Unmaps the current file, if any
+     */
+    void close();
+
+    /**
+     * @brief Header of the open save; only valid after a successful open()
+     */
+    const SaveStateHeader &header() const { return *m_header; }
+
+    /**
+     * @brief Hazard records of the open save, header().hazardCount of them
+     */
+    const SavedHazard *hazards() const { return m_hazards; }
+};
+
+#endif // SAVESTATE_H
@@ -0,0 +1,106 @@
+/**
+ * @file headlesssimulation.cpp
+ * @brief Implementation of the headless contact listener, scripted input and batch runs
+ *
+ * @author Team AJKJ
+ */
+
+#include "headlesssimulation.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+void HeadlessContactListener::handleContacts(const std::vector<ContactEvent> &events)
+{
+    const HazardStore &hazards = m_physicsWorld->getHazards();
+    for (const ContactEvent &event : events) {
+        int index = hazards.indexOf(event.hazard);
+        if (event.type == ContactEvent::Begin && index >= 0 && m_processedHazards.insert(event.hazard)) {
+            m_physicsWorld->queueForRemoval(event.hazard);
+            m_plantsReached++;
+        }
+    }
+}
+
+namespace {
+
+const char *const ScriptNames[] = {"hold-right", "stop-and-go", "rocking"};  // Every script scriptedDriveForce knows
+
+} // namespace
+
+float scriptedDriveForce(const std::string &script, int step, float timeStep, float driveForce)
+{
+    float t = step * timeStep;
+
+    if (script == "stop-and-go") {
+        // Drive for three seconds, coast for one
+        return (static_cast<int>(t) % 4 < 3) ? driveForce : 0.0f;
+    }
+    if (script == "rocking") {
+        // Two seconds forward, one second back
+        return (static_cast<int>(t) % 3 < 2) ? driveForce : -driveForce;
+    }
+    return driveForce; // "hold-right"
+}
+
+bool isKnownScript(const std::string &script)
+{
+    return std::find(std::begin(ScriptNames), std::end(ScriptNames), script) != std::end(ScriptNames);
+}
+
+SimulationResult runSimulation(const SimulationTask &task)
+{
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point start = Clock::now();
+
+    PhysicsWorld world(task.hazardCount, task.seed, task.roadPointCount, task.vehicle);
+    world.setQuality(task.quality);
+    HeadlessContactListener *listener = new HeadlessContactListener(&world); // Owned by the world
+    world.setContactHandler(listener);
+
+    SimulationResult result = {};
+    Clock::duration stepTime = Clock::duration::zero();
+    while (result.steps < task.maxSteps && !result.finished) {
+        world.getVehicle()->applyDriveForce(scriptedDriveForce(task.script, result.steps, world.timeStep(),
+                                                               task.vehicle.driveForce));
+        Clock::time_point stepStart = Clock::now();
+        world.step();
+        stepTime += Clock::now() - stepStart;
+        result.steps++;
+        result.finished = world.hasReachedEnd();
+    }
+
+    result.simulatedSeconds = result.steps * world.timeStep();
+    result.plantsReached = listener->plantsReached();
+    result.stepMicros = std::chrono::duration<double, std::micro>(stepTime).count() / std::max(1, result.steps);
+    result.wallMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    return result;
+}
+
+std::vector<SimulationResult> runBatch(const std::vector<SimulationTask> &tasks, int threadCount)
+{
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    threadCount = std::min(threadCount, static_cast<int>(tasks.size()));
+
+    // Each result slot is written by exactly one worker, so no locking is needed
+    std::vector<SimulationResult> results(tasks.size());
+    std::atomic<size_t> nextTask(0);
+    auto worker = [&]() {
+        for (size_t i = nextTask++; i < tasks.size(); i = nextTask++) {
+            results[i] = runSimulation(tasks[i]);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+    for (int i = 0; i < threadCount; ++i) {
+        workers.emplace_back(worker);
+    }
+    for (std::thread &thread : workers) {
+        thread.join();
+    }
+    return results;
+}
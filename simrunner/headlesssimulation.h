@@ -0,0 +1,95 @@
+/**
+ * @file headlesssimulation.h
+ * @brief Defines the pieces shared by simrunner's single and batch modes: the headless
+ *        contact listener, scripted input, and running many worlds across threads
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef HEADLESSSIMULATION_H
+#define HEADLESSSIMULATION_H
+
+#include "physicsworld.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Minimal stand-in for GameContactListener: queues touched plants for removal
+ * exactly like the game does, but without any signal or dialog.
+ */
+class HeadlessContactListener : public ContactHandler {
+
+private:
+
+    PhysicsWorld *m_physicsWorld;
+    HazardHandleSet m_processedHazards;
+    int m_plantsReached = 0;
+
+public:
+
+    explicit HeadlessContactListener(PhysicsWorld *physicsWorld) : m_physicsWorld(physicsWorld) { }
+
+    void handleContacts(const std::vector<ContactEvent> &events) override;
+
+    int plantsReached() const { return m_plantsReached; }
+};
+
+/**
+ * @brief Scripted drive input, equivalent to holding the arrow keys in the game
+ * @param script Script name: hold-right, stop-and-go or rocking
+ * @param step Current step index
+ * @param timeStep Simulation time step in seconds
+ * @param driveForce Force an arrow key applies, from the vehicle's definition
+ * @return Drive force to apply for this step
+ */
+float scriptedDriveForce(const std::string &script, int step, float timeStep, float driveForce);
+
+/**
+ * @brief Returns whether scriptedDriveForce knows a script name
+ * @param script Script name
+ */
+bool isKnownScript(const std::string &script);
+
+/**
+ * @brief One independent run of a batch
+ */
+struct SimulationTask {
+    unsigned int seed;      // Seed the level is generated from
+    int hazardCount;        // Hazards requested for the level
+    int roadPointCount;     // Road vertices, or TerrainProfile::Endless
+    std::string script;     // Drive input script
+    int maxSteps;           // Steps to give up after if the house is never reached
+    PhysicsQuality quality; // Physics quality profile to step with
+    VehicleSpec vehicle;    // Vehicle to drive
+};
+
+/**
+ * @brief Outcome of one run of a batch
+ */
+struct SimulationResult {
+    bool finished;          // True if the vehicle reached grandma's house
+    int steps;              // Steps taken, up to and including the one that finished
+    float simulatedSeconds; // Simulated time the steps cover
+    int plantsReached;      // Plants the vehicle touched on the way
+    double wallMs;          // Wall time the run took, world construction included
+    double stepMicros;      // Mean wall time of one PhysicsWorld::step
+};
+
+/**
+ * @brief Builds a world for the task and drives it until the house is reached or the step
+ *        limit runs out. Everything the run touches is local to the call.
+ * @param task Run to perform
+ * @return Outcome of the run
+ */
+SimulationResult runSimulation(const SimulationTask &task);
+
+/**
+ * @brief Runs every task on a pool of worker threads. Each worker takes the next unclaimed
+ *        task and builds its own world for it, so workers share nothing but the task counter.
+ * @param tasks Runs to perform
+ * @param threadCount Number of worker threads; 0 uses one per hardware thread
+ * @return One result per task, in task order
+ */
+std::vector<SimulationResult> runBatch(const std::vector<SimulationTask> &tasks, int threadCount);
+
+#endif // HEADLESSSIMULATION_H
@@ -0,0 +1,565 @@
+/**
+ * @file main.cpp
+ * @brief Headless simulation runner for PhysicsWorld
+ *
+ * @author Team AJKJ
+ *
+ * Runs a fixed number of physics steps as fast as possible with a scripted drive input
+ * and reports throughput, per-step latency percentiles and the final simulation state.
+ * No window or QtWidgets code is involved, so the numbers reflect the simulation only.
+ *
+ * Usage: simrunner [--steps N] [--hazards N] [--road-points N] [--seed N] [--script hold-right|stop-and-go|rocking]
+ *                  [--load-state FILE] [--save-state FILE] [--record FILE] [--replay FILE] [--realtime]
+ *                  [--quality low|default|high|adaptive] [--vehicle FILE]
+ *        (--road-points 0 gives an endless road, walled off at 65536 m where longer roads
+ *        are cut; --load-state starts from a save-state and overrides the level options,
+ *        --save-state writes the final state; --record writes the drive input to a recording,
+ *        --replay drives from one instead of the script and overrides the level options, the
+ *        quality and, unless given, --steps; --realtime paces the steps to wall time instead
+ *        of running unthrottled; --vehicle reads a vehicle definition file)
+ *
+ * Batch mode: simrunner --batch N [--threads N] [--steps N] [--hazards N] [--road-points N] [--seed N]
+ *                       [--script NAME[,NAME...]] [--quality NAME] [--vehicle FILE]
+ *        Runs N worlds seeded from --seed upwards for every listed script, spread over a pool
+ *        of worker threads (one per hardware thread by default), each until the house is
+ *        reached or --steps runs out, and prints one table row per world.
+ *
+ * Sweep mode: simrunner --sweep NAME=V[,V...] [--sweep NAME=V[,V...]] [batch options]
+ *        Varies vehicle definition values over the grid of every listed value, starting
+ *        from --vehicle or the built-in car, runs each combination like batch mode (one
+ *        seed unless --batch is given) and ranks the combinations by how many runs reached
+ *        the house, then mean time to finish, then mean wall time per step.
+ */
+
+#include "gamemanager.h"
+#include "headlesssimulation.h"
+#include "inputrecording.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Returns the given percentile of an already sorted sample set
+ */
+double percentile(const std::vector<double> &sorted, double p)
+{
+    if (sorted.empty()) return 0.0;
+    size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+void printUsage(const char *program)
+{
+    std::printf("Usage: %s [--steps N] [--hazards N] [--road-points N] [--seed N] [--script hold-right|stop-and-go|rocking]\n"
+                "       [--load-state FILE] [--save-state FILE] [--record FILE] [--replay FILE] [--realtime]\n"
+                "       [--quality low|default|high|adaptive] [--vehicle FILE]\n"
+                "       --road-points 0 gives an endless road, walled off at 65536 m where longer roads are cut\n"
+                "       --load-state starts from a save-state and overrides the level options\n"
+                "       --replay drives from a recording and overrides the level options, the quality and, unless given, --steps\n"
+                "       --realtime paces the steps to wall time instead of running unthrottled\n"
+                "       %s --batch N [--threads N] [--steps N] [--hazards N] [--road-points N] [--seed N]\n"
+                "       [--script NAME[,NAME...]] [--quality NAME] [--vehicle FILE]\n"
+                "       %s --sweep NAME=V[,V...] [--sweep NAME=V[,V...]] [batch options]\n"
+                "       sweeps vehicle definition values, e.g. --sweep wheelRadius=0.15,0.25\n",
+                program, program, program);
+}
+
+/**
+ * @brief Looks up a quality profile by its command line name
+ * @param name Profile name
+ * @param quality Set to the profile if the name is known
+ * @return True if the name is known
+ */
+bool parseQuality(const char *name, PhysicsQuality &quality)
+{
+    for (int i = 0; i <= static_cast<int>(PhysicsQuality::Adaptive); ++i) {
+        if (std::strcmp(name, toString(static_cast<PhysicsQuality>(i))) == 0) {
+            quality = static_cast<PhysicsQuality>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Splits a comma-separated list
+ */
+std::vector<std::string> splitList(const std::string &list)
+{
+    std::vector<std::string> items;
+    size_t begin = 0;
+    while (begin <= list.size()) {
+        size_t end = std::min(list.find(',', begin), list.size());
+        items.push_back(list.substr(begin, end - begin));
+        begin = end + 1;
+    }
+    return items;
+}
+
+/**
+ * @brief Appends one task per seed and script for the base task
+ * @param baseTask Level options, vehicle and step limit shared by the tasks
+ * @param scripts Comma-separated script names
+ * @param seedCount Number of seeds, counting up from the base task's seed
+ * @param tasks Receives the tasks
+ */
+void addSeedAndScriptTasks(const SimulationTask &baseTask, const std::string &scripts, int seedCount,
+                           std::vector<SimulationTask> &tasks)
+{
+    // Every seed is run with every script
+    for (const std::string &script : splitList(scripts)) {
+        SimulationTask task = baseTask;
+        task.script = script;
+        for (int i = 0; i < seedCount; ++i) {
+            task.seed = baseTask.seed + static_cast<unsigned int>(i);
+            tasks.push_back(task);
+        }
+    }
+}
+
+/**
+ * @brief Runs tasks on the worker pool and times the whole batch
+ * @param threadCount Number of worker threads; 0 uses one per hardware thread, and is
+ *        replaced by the count used
+ */
+std::vector<SimulationResult> runTimedBatch(const std::vector<SimulationTask> &tasks, int &threadCount,
+                                            double &wallSeconds)
+{
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    threadCount = std::min(threadCount, static_cast<int>(tasks.size()));
+
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point start = Clock::now();
+    std::vector<SimulationResult> results = runBatch(tasks, threadCount);
+    wallSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return results;
+}
+
+/**
+ * @brief Runs the batch mode and prints its table
+ * @param baseTask Level options and step limit shared by every run
+ * @param scripts Comma-separated script names
+ * @param seedCount Number of seeds, counting up from the base task's seed
+ * @param threadCount Number of worker threads; 0 uses one per hardware thread
+ * @return Exit code
+ */
+int runBatchMode(const SimulationTask &baseTask, const std::string &scripts, int seedCount, int threadCount)
+{
+    std::vector<SimulationTask> tasks;
+    addSeedAndScriptTasks(baseTask, scripts, seedCount, tasks);
+
+    double wallSeconds = 0.0;
+    std::vector<SimulationResult> results = runTimedBatch(tasks, threadCount, wallSeconds);
+
+    std::printf("%-10s  %-12s  %-8s  %7s  %8s  %6s  %9s\n",
+                "seed", "script", "finished", "steps", "time s", "plants", "wall ms");
+    long long totalSteps = 0;
+    int finishedCount = 0;
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        const SimulationResult &result = results[i];
+        std::printf("%-10u  %-12s  %-8s  %7d  %8.2f  %6d  %9.2f\n",
+                    tasks[i].seed, tasks[i].script.c_str(), result.finished ? "yes" : "no",
+                    result.steps, result.simulatedSeconds, result.plantsReached, result.wallMs);
+        totalSteps += result.steps;
+        finishedCount += result.finished ? 1 : 0;
+    }
+
+    std::printf("\nworlds            %zu (%d finished)\n", tasks.size(), finishedCount);
+    std::printf("threads           %d\n", threadCount);
+    std::printf("wall time         %.3f s\n", wallSeconds);
+    std::printf("worlds/sec        %.1f\n", tasks.size() / wallSeconds);
+    std::printf("steps/sec         %.0f (all threads)\n", totalSteps / wallSeconds);
+    return 0;
+}
+
+/**
+ * @brief One vehicle definition value a sweep varies
+ */
+struct SweepParameter {
+    std::string name;               // Definition file key
+    float VehicleSpec::*member;     // Member the key sets
+    std::vector<float> values;      // Values to try
+};
+
+/**
+ * @brief Parses a --sweep argument of the form NAME=V[,V...]
+ * @return True if the name is a vehicle definition key and every value is a number
+ */
+bool parseSweep(const char *argument, SweepParameter &parameter)
+{
+    std::string text = argument;
+    size_t equals = text.find('=');
+    if (equals == std::string::npos) {
+        return false;
+    }
+    parameter.name = text.substr(0, equals);
+    parameter.member = VehicleSpec::member(QString::fromUtf8(parameter.name.c_str()));
+    if (!parameter.member) {
+        return false;
+    }
+    parameter.values.clear();
+    for (const std::string &item : splitList(text.substr(equals + 1))) {
+        char *end = nullptr;
+        float value = std::strtof(item.c_str(), &end);
+        if (item.empty() || *end != '\0') {
+            return false;
+        }
+        parameter.values.push_back(value);
+    }
+    return true;
+}
+
+/**
+ * @brief Runs every combination of the sweep's values in parallel and prints them ranked
+ * @param baseTask Level options, base vehicle and step limit shared by every run
+ * @param scripts Comma-separated script names
+ * @param seedCount Number of seeds per combination, counting up from the base task's seed
+ * @param threadCount Number of worker threads; 0 uses one per hardware thread
+ * @param parameters Values to vary; every combination of them is run
+ * @return Exit code
+ */
+int runSweepMode(const SimulationTask &baseTask, const std::string &scripts, int seedCount, int threadCount,
+                 const std::vector<SweepParameter> &parameters)
+{
+    // Walk the grid like a mixed-radix counter, one digit per parameter
+    std::vector<VehicleSpec> combinations;
+    std::vector<size_t> digits(parameters.size(), 0);
+    for (;;) {
+        VehicleSpec spec = baseTask.vehicle;
+        for (size_t p = 0; p < parameters.size(); ++p) {
+            spec.*parameters[p].member = parameters[p].values[digits[p]];
+        }
+        if (!spec.isValid()) {
+            std::fprintf(stderr, "Sweep combination %zu is not a valid vehicle\n", combinations.size() + 1);
+            return 1;
+        }
+        combinations.push_back(spec);
+
+        size_t p = 0;
+        while (p < parameters.size() && ++digits[p] == parameters[p].values.size()) {
+            digits[p++] = 0;
+        }
+        if (p == parameters.size()) {
+            break;
+        }
+    }
+
+    // Every combination gets the same seeds and scripts, so their tasks are contiguous
+    std::vector<SimulationTask> tasks;
+    for (const VehicleSpec &spec : combinations) {
+        SimulationTask task = baseTask;
+        task.vehicle = spec;
+        addSeedAndScriptTasks(task, scripts, seedCount, tasks);
+    }
+    const size_t runsPerCombination = tasks.size() / combinations.size();
+
+    double wallSeconds = 0.0;
+    std::vector<SimulationResult> results = runTimedBatch(tasks, threadCount, wallSeconds);
+
+    struct Score {
+        size_t combination;
+        int finished;               // Runs that reached the house
+        double meanFinishSeconds;   // Mean simulated time of the runs that finished
+        double meanStepMicros;      // Mean wall time per step over every run
+    };
+    std::vector<Score> scores;
+    for (size_t c = 0; c < combinations.size(); ++c) {
+        Score score = {c, 0, 0.0, 0.0};
+        for (size_t r = c * runsPerCombination; r < (c + 1) * runsPerCombination; ++r) {
+            if (results[r].finished) {
+                score.finished++;
+                score.meanFinishSeconds += results[r].simulatedSeconds;
+            }
+            score.meanStepMicros += results[r].stepMicros;
+        }
+        score.meanFinishSeconds = score.finished > 0 ? score.meanFinishSeconds / score.finished : 0.0;
+        score.meanStepMicros /= runsPerCombination;
+        scores.push_back(score);
+    }
+    std::stable_sort(scores.begin(), scores.end(), [](const Score &a, const Score &b) {
+        if (a.finished != b.finished) return a.finished > b.finished;
+        if (a.meanFinishSeconds != b.meanFinishSeconds) return a.meanFinishSeconds < b.meanFinishSeconds;
+        return a.meanStepMicros < b.meanStepMicros;
+    });
+
+    std::printf("%-4s", "rank");
+    for (const SweepParameter &parameter : parameters) {
+        std::printf("  %*s", static_cast<int>(std::max<size_t>(parameter.name.size(), 8)), parameter.name.c_str());
+    }
+    std::printf("  %8s  %8s  %8s\n", "finished", "time s", "step us");
+    for (size_t rank = 0; rank < scores.size(); ++rank) {
+        const Score &score = scores[rank];
+        std::printf("%-4zu", rank + 1);
+        for (const SweepParameter &parameter : parameters) {
+            std::printf("  %*g", static_cast<int>(std::max<size_t>(parameter.name.size(), 8)),
+                        combinations[score.combination].*parameter.member);
+        }
+        std::string finished = std::to_string(score.finished) + "/" + std::to_string(runsPerCombination);
+        if (score.finished > 0) {
+            std::printf("  %8s  %8.2f  %8.2f\n", finished.c_str(), score.meanFinishSeconds, score.meanStepMicros);
+        } else {
+            std::printf("  %8s  %8s  %8.2f\n", finished.c_str(), "-", score.meanStepMicros);
+        }
+    }
+
+    std::printf("\ncombinations      %zu (%zu runs each)\n", combinations.size(), runsPerCombination);
+    std::printf("threads           %d\n", threadCount);
+    std::printf("wall time         %.3f s\n", wallSeconds);
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    int steps = 3600;
+    int hazardCount = 15;
+    int roadPointCount = PhysicsWorld::DefaultRoadPointCount;
+    unsigned int seed = 1;
+    std::string script = "hold-right";
+    const char *loadPath = nullptr;
+    const char *savePath = nullptr;
+    const char *recordPath = nullptr;
+    const char *replayPath = nullptr;
+    bool stepsGiven = false;
+    bool realtime = false;
+    int batchCount = 0;
+    int threadCount = 0;
+    PhysicsQuality quality = PhysicsQuality::Default;
+    VehicleSpec vehicle;
+    const char *vehiclePath = nullptr;
+    std::vector<SweepParameter> sweep;
+
+    // Parse command line options
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--steps") == 0 && hasValue) {
+            steps = std::max(1, std::atoi(argv[++i]));
+            stepsGiven = true;
+        } else if (std::strcmp(argv[i], "--hazards") == 0 && hasValue) {
+            hazardCount = std::max(0, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--road-points") == 0 && hasValue) {
+            roadPointCount = std::atoi(argv[++i]);
+            if (roadPointCount != TerrainProfile::Endless) {
+                roadPointCount = std::max(2, roadPointCount);
+            }
+            if (roadPointCount > TerrainProfile::maxVertexCount()) {
+                std::fprintf(stderr, "--road-points %d ends past %.0f m, where positions get too coarse for the physics; using %d\n",
+                             roadPointCount, TerrainProfile::MaxPreciseX, TerrainProfile::maxVertexCount());
+                roadPointCount = TerrainProfile::maxVertexCount();
+            }
+        } else if (std::strcmp(argv[i], "--seed") == 0 && hasValue) {
+            seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--script") == 0 && hasValue) {
+            script = argv[++i];
+            std::vector<std::string> names = splitList(script);
+            if (!std::all_of(names.begin(), names.end(), isKnownScript)) {
+                std::fprintf(stderr, "--script takes hold-right, stop-and-go or rocking, or a comma-separated list of them with --batch or --sweep\n");
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--load-state") == 0 && hasValue) {
+            loadPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--save-state") == 0 && hasValue) {
+            savePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--record") == 0 && hasValue) {
+            recordPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && hasValue) {
+            replayPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--realtime") == 0) {
+            realtime = true;
+        } else if (std::strcmp(argv[i], "--batch") == 0 && hasValue) {
+            batchCount = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            threadCount = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--quality") == 0 && hasValue && parseQuality(argv[i + 1], quality)) {
+            ++i;
+        } else if (std::strcmp(argv[i], "--vehicle") == 0 && hasValue) {
+            vehiclePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--sweep") == 0 && hasValue) {
+            SweepParameter parameter;
+            if (!parseSweep(argv[++i], parameter)) {
+                std::fprintf(stderr, "--sweep takes a vehicle definition key and numbers, e.g. wheelRadius=0.15,0.25\n");
+                return 1;
+            }
+            sweep.push_back(parameter);
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (vehiclePath && !VehicleSpec::load(QString::fromUtf8(vehiclePath), vehicle)) {
+        std::fprintf(stderr, "Could not read vehicle definition %s\n", vehiclePath);
+        return 1;
+    }
+
+    if (batchCount > 0 || !sweep.empty()) {
+        if (loadPath || savePath || recordPath || replayPath || realtime) {
+            std::fprintf(stderr, "--batch and --sweep only take level, step, script, quality, vehicle and thread options\n");
+            return 1;
+        }
+        SimulationTask baseTask = {seed, hazardCount, roadPointCount, script, steps, quality, vehicle};
+        if (!sweep.empty()) {
+            return runSweepMode(baseTask, script, std::max(1, batchCount), threadCount, sweep);
+        }
+        return runBatchMode(baseTask, script, batchCount, threadCount);
+    }
+
+    // A single run drives with one script
+    if (script.find(',') != std::string::npos) {
+        std::fprintf(stderr, "--script takes a list of names only with --batch or --sweep\n");
+        return 1;
+    }
+
+    // Recordings start from a generated level, not from the middle of a save
+    if ((replayPath || recordPath) && loadPath) {
+        std::fprintf(stderr, "--record and --replay cannot be combined with --load-state\n");
+        return 1;
+    }
+
+    using Clock = std::chrono::steady_clock;
+
+    // A recording decides which level is built and, by default, how long to run
+    InputReplay replay;
+    if (replayPath) {
+        if (!replay.open(QString::fromUtf8(replayPath))) {
+            std::fprintf(stderr, "Could not read recording %s\n", replayPath);
+            return 1;
+        }
+        seed = replay.header().seed;
+        hazardCount = replay.header().hazardCount;
+        roadPointCount = replay.header().roadPointCount;
+        quality = static_cast<PhysicsQuality>(replay.header().quality);
+        if (!stepsGiven) {
+            steps = std::max<int>(1, static_cast<int>(replay.header().stepCount));
+        }
+    }
+
+    // A save-state decides which level is built
+    SaveState save;
+    if (loadPath) {
+        if (!save.open(QString::fromUtf8(loadPath))) {
+            std::fprintf(stderr, "Could not read save-state %s\n", loadPath);
+            return 1;
+        }
+        seed = save.header().world.seed;
+        hazardCount = save.header().world.hazardCount;
+        roadPointCount = save.header().world.roadPointCount;
+    }
+
+    Clock::time_point buildStart = Clock::now();
+    PhysicsWorld world(hazardCount, seed, roadPointCount, vehicle);
+    world.setQuality(quality);
+    HeadlessContactListener *listener = new HeadlessContactListener(&world); // Owned by the world
+    world.setContactHandler(listener);
+    double buildMs = std::chrono::duration<double, std::milli>(Clock::now() - buildStart).count();
+
+    double loadMs = 0.0;
+    if (loadPath) {
+        Clock::time_point loadStart = Clock::now();
+        bool loaded = world.loadState(save.header().world, save.hazards(), save.header().hazardCount);
+        loadMs = std::chrono::duration<double, std::milli>(Clock::now() - loadStart).count();
+        if (!loaded) {
+            std::fprintf(stderr, "Save-state %s does not fit this world\n", loadPath);
+            return 1;
+        }
+        save.close();
+    }
+
+    const float timeStep = 1.0f / 60.0f;
+    std::vector<double> stepMicros;
+    stepMicros.reserve(steps);
+    long long subSteps = 0;
+
+    InputRecorder recorder;
+    if (recordPath) {
+        recorder.start(world);
+    }
+    if (replayPath) {
+        replay.begin(world);
+    }
+
+    // Run the simulation unthrottled, or paced to wall time with --realtime, timing every
+    // step individually
+    Clock::time_point runStart = Clock::now();
+    for (int i = 0; i < steps; ++i) {
+        if (realtime) {
+            std::this_thread::sleep_until(runStart + std::chrono::duration_cast<Clock::duration>(
+                                                         std::chrono::duration<double>(i * timeStep)));
+        }
+
+        if (replayPath) {
+            replay.applyInputs(world);
+        } else {
+            float force = scriptedDriveForce(script, i, timeStep, vehicle.driveForce);
+            recorder.record(world, force);
+            world.getVehicle()->applyDriveForce(force);
+        }
+
+        Clock::time_point stepStart = Clock::now();
+        world.step();
+        subSteps += world.solverSettings().subSteps;
+        stepMicros.push_back(std::chrono::duration<double, std::micro>(Clock::now() - stepStart).count());
+    }
+    double runSeconds = std::chrono::duration<double>(Clock::now() - runStart).count();
+
+    std::sort(stepMicros.begin(), stepMicros.end());
+
+    b2Body *chassis = world.getVehicle()->getChassis();
+    b2Vec2 position = chassis->GetPosition();
+    b2Vec2 velocity = chassis->GetLinearVelocity();
+
+    std::printf("script            %s\n", replayPath ? replayPath : script.c_str());
+    std::printf("seed              %u\n", seed);
+    std::printf("steps             %d (%.1f s simulated)\n", steps, steps * timeStep);
+    std::printf("quality           %s (%.2f sub-steps per step)\n",
+                toString(quality), static_cast<double>(subSteps) / steps);
+    std::printf("world build       %.3f ms\n", buildMs);
+    if (loadPath) {
+        std::printf("state load        %.3f ms (%s)\n", loadMs, loadPath);
+    }
+    std::printf("wall time         %.3f s\n", runSeconds);
+    std::printf("steps/sec         %.0f\n", steps / runSeconds);
+    std::printf("step latency us   p50 %.1f  p90 %.1f  p99 %.1f  max %.1f\n",
+                percentile(stepMicros, 0.50), percentile(stepMicros, 0.90),
+                percentile(stepMicros, 0.99), stepMicros.back());
+    std::printf("chassis position  (%.3f, %.3f)\n", position.x, position.y);
+    std::printf("chassis velocity  (%.3f, %.3f)\n", velocity.x, velocity.y);
+    std::printf("plants reached    %d\n", listener->plantsReached());
+    std::printf("hazards unplaced  %d\n", world.unplacedHazardCount());
+    int activeHazards = 0;
+    for (b2Body *body : world.getHazards().bodies()) {
+        activeHazards += body->IsActive() ? 1 : 0;
+    }
+    std::printf("hazards remaining %zu (%d active)\n", world.getHazards().size(), activeHazards);
+    std::printf("road chunks       %zu loaded\n", world.getTerrain().chunks().size());
+    std::printf("bodies in world   %d\n", world.getWorld().GetBodyCount());
+
+    if (recordPath) {
+        recorder.stop(world);
+        if (!recorder.write(QString::fromUtf8(recordPath))) {
+            std::fprintf(stderr, "Could not write recording %s\n", recordPath);
+        }
+    }
+
+    if (savePath) {
+        // A headless run has no game manager; save it as the first level in play
+        SavedProgress progress = {};
+        progress.gameState = Level1;
+        progress.level = 1;
+        if (!SaveState::write(QString::fromUtf8(savePath), world, progress)) {
+            std::fprintf(stderr, "Could not write save-state %s\n", savePath);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,44 @@
+# Headless simulation runner: steps PhysicsWorld without any QtWidgets code
+# so physics changes can be measured and soak-tested from the command line.
+
+QT       = core
+
+CONFIG += c++17 console thread
+CONFIG -= app_bundle
+
+TARGET = simrunner
+
+include(../Box2D.pri)
+
+INCLUDEPATH += $$PWD/..
+
+SOURCES += \
+    headlesssimulation.cpp \
+    main.cpp \
+    ../contactevents.cpp \
+    ../hazardplacer.cpp \
+    ../hazardstore.cpp \
+    ../inputrecording.cpp \
+    ../physicsworld.cpp \
+    ../plantcatalog.cpp \
+    ../randomgenerator.cpp \
+    ../savestate.cpp \
+    ../terrain.cpp \
+    ../terrainprofile.cpp \
+    ../vehicle.cpp \
+    ../vehiclespec.cpp
+
+HEADERS += \
+    headlesssimulation.h \
+    ../contactevents.h \
+    ../hazardplacer.h \
+    ../hazardstore.h \
+    ../inputrecording.h \
+    ../physicsworld.h \
+    ../plantcatalog.h \
+    ../randomgenerator.h \
+    ../savestate.h \
+    ../terrain.h \
+    ../terrainprofile.h \
+    ../vehicle.h \
+    ../vehiclespec.h
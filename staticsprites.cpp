@@ -0,0 +1,169 @@
+/**
+ * @file staticsprites.cpp
+ * @brief Implementation of the StaticSprites class
+ *
+ * @author Team AJKJ
+ */
+
+#include "staticsprites.h"
+#include <QPainterPath>
+#include <cmath>
+
+namespace {
+
+const float HouseSize = 3.0f;           // Width and height of the house's base in meters
+const float HouseSink = 0.85f;          // How far the base reaches below the anchor, in meters
+const float RoofHeight = 0.7f;          // Roof height as a fraction of the base
+const float RoofOverhang = 15.0f;       // Roof overhang either side of the base, in pixels
+const float CarBodyHalfWidth = 1.2f;    // Car body reach either side of the chassis center, in drawing units
+const float CarBodyHeight = 0.8f;       // Car body height above the chassis center, in drawing units
+const float WheelRadius = 0.3f;         // Tire radius in wheel drawing units
+const float SpritePadding = 1.0f;       // Room for the outline pen around a sprite, in pixels
+
+/**
+ * @brief Makes a transparent pixmap covering a logical size at a device pixel ratio
+ */
+QPixmap transparentPixmap(const QSizeF &size, qreal devicePixelRatio)
+{
+    QPixmap pixmap(static_cast<int>(std::ceil(size.width() * devicePixelRatio)),
+                   static_cast<int>(std::ceil(size.height() * devicePixelRatio)));
+    pixmap.setDevicePixelRatio(devicePixelRatio);
+    pixmap.fill(Qt::transparent);
+    return pixmap;
+}
+
+} // namespace
+
+StaticSprites::StaticSprites() : m_scale(0.0f),
+                                 m_chassisScaleX(0.0f),
+                                 m_chassisScaleY(0.0f),
+                                 m_wheelScale(0.0f),
+                                 m_devicePixelRatio(0.0) { }
+
+void StaticSprites::setResolution(float scale, const VehicleSpec &vehicle, qreal devicePixelRatio)
+{
+    const VehicleSpec defaultSpec;
+    float chassisScaleX = scale * vehicle.chassisHalfWidth / defaultSpec.chassisHalfWidth;
+    float chassisScaleY = scale * vehicle.chassisHalfHeight / defaultSpec.chassisHalfHeight;
+    float wheelScale = scale * vehicle.wheelRadius / defaultSpec.wheelRadius;
+
+    bool screenChanged = scale != m_scale || devicePixelRatio != m_devicePixelRatio;
+    bool chassisChanged = screenChanged || chassisScaleX != m_chassisScaleX || chassisScaleY != m_chassisScaleY;
+    bool wheelChanged = screenChanged || wheelScale != m_wheelScale;
+    m_scale = scale;
+    m_chassisScaleX = chassisScaleX;
+    m_chassisScaleY = chassisScaleY;
+    m_wheelScale = wheelScale;
+    m_devicePixelRatio = devicePixelRatio;
+
+    if (screenChanged) {
+        drawHouseSprite();
+    }
+    if (chassisChanged) {
+        drawCarBodySprite();
+    }
+    if (wheelChanged) {
+        drawWheelSprite();
+    }
+}
+
+void StaticSprites::drawHouseSprite()
+{
+    const float width = m_scale * HouseSize;
+    const float height = m_scale * HouseSize;
+    const float roofHeight = RoofHeight * height;
+
+    // The base's top edge is a base height up from the anchor, less the part sunk into
+    // the road. The roof rises from that edge and overhangs the base either side.
+    QPointF baseTop(0, -height + m_scale * HouseSink);
+    QPointF topLeft(-width / 2 - RoofOverhang - SpritePadding, -roofHeight - SpritePadding);
+    m_houseOffset = baseTop + topLeft;
+    m_house = transparentPixmap(QSizeF(width + 2 * (RoofOverhang + SpritePadding),
+                                       roofHeight + height + 2 * SpritePadding), m_devicePixelRatio);
+
+    QPainter painter(&m_house);
+    painter.translate(-topLeft);
+
+    // Draw base (square part)
+    QRectF base(-width / 2, 0, width, height);
+    painter.setBrush(Qt::gray);
+    painter.setPen(Qt::white);
+    painter.drawRect(base);
+
+    // Draw roof (triangle)
+    QPolygonF roof;
+    roof << QPointF(-width / 2 - RoofOverhang, 0)
+         << QPointF(width / 2 + RoofOverhang, 0)
+         << QPointF(0, -roofHeight);
+    painter.setBrush(Qt::darkRed);
+    painter.drawPolygon(roof);
+}
+
+void StaticSprites::drawCarBodySprite()
+{
+    m_carBodyOffset = QPointF(-CarBodyHalfWidth * m_chassisScaleX, -CarBodyHeight * m_chassisScaleY);
+    m_carBody = transparentPixmap(QSizeF(2 * CarBodyHalfWidth * m_chassisScaleX, CarBodyHeight * m_chassisScaleY),
+                                  m_devicePixelRatio);
+
+    QPainter painter(&m_carBody);
+    painter.translate(-m_carBodyOffset);
+    painter.scale(m_chassisScaleX, m_chassisScaleY);
+
+    // Car body design
+    QPainterPath carBody;
+    carBody.moveTo(-1.2, 0.0);       // rear bottom
+    carBody.lineTo(-1.2, -0.4);      // rear up
+    carBody.lineTo(-0.8, -0.8);      // curve to roof
+    carBody.lineTo(0.4, -0.8);       // roof
+    carBody.lineTo(0.6, -0.5);       // sloped front
+    carBody.lineTo(1.2, -0.4);       // bottom front up
+    carBody.lineTo(1.2, 0.0);        // front bottom
+    carBody.lineTo(-1.2, 0.0);       // close
+    carBody.closeSubpath();
+
+    painter.setBrush(QColor(200, 40, 40));  // 진한 빨간색
+    painter.setPen(Qt::NoPen);
+    painter.drawPath(carBody);
+}
+
+void StaticSprites::drawWheelSprite()
+{
+    float radius = WheelRadius * m_wheelScale;
+    m_wheelOffset = QPointF(-radius, -radius);
+    m_wheel = transparentPixmap(QSizeF(2 * radius, 2 * radius), m_devicePixelRatio);
+
+    QPainter painter(&m_wheel);
+    painter.translate(radius, radius);
+    painter.scale(m_wheelScale, m_wheelScale);
+    painter.setPen(Qt::NoPen);
+
+    // Outer white tire
+    QRectF outerWheel(-0.3, -0.3, 0.6, 0.6);
+    painter.setBrush(Qt::black);
+    painter.drawEllipse(outerWheel);
+
+    // Inner white hub
+    QRectF innerWheel(-0.18, -0.18, 0.36, 0.36);
+    painter.setBrush(Qt::gray);
+    painter.drawEllipse(innerWheel);
+
+    // Center dot (larger gray hub center)
+    QRectF centerDot(-0.045, -0.045, 0.09, 0.09);
+    painter.setBrush(Qt::black);
+    painter.drawEllipse(centerDot);
+}
+
+void StaticSprites::drawHouse(QPainter &painter, const QPointF &screenPos) const
+{
+    painter.drawPixmap(screenPos + m_houseOffset, m_house);
+}
+
+void StaticSprites::drawCarBody(QPainter &painter, const QPointF &screenPos) const
+{
+    painter.drawPixmap(screenPos + m_carBodyOffset, m_carBody);
+}
+
+void StaticSprites::drawWheel(QPainter &painter, const QPointF &screenPos) const
+{
+    painter.drawPixmap(screenPos + m_wheelOffset, m_wheel);
+}
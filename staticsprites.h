@@ -0,0 +1,92 @@
+/**
+ * @file staticsprites.h
+ * @brief Defines the StaticSprites class that caches the house and vehicle drawings
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef STATICSPRITES_H
+#define STATICSPRITES_H
+
+#include "vehiclespec.h"
+#include <QPainter>
+#include <QPixmap>
+
+/**
+ * @brief The drawings that look the same every frame, rasterised once instead of per paint.
+ *
+ * None of them turns on screen: the house stands still, the chassis is built with fixed
+ * rotation and a wheel is concentric circles. Each is drawn into a pixmap at the current
+ * pixels per meter and device pixel ratio, stretched for the vehicle's size, and a frame
+ * only blits it. A pixmap is redrawn when anything it was drawn at changes.
+ */
+class StaticSprites {
+
+private:
+
+    float m_scale;                  // Pixels per meter the pixmaps were drawn at
+    float m_chassisScaleX;          // Horizontal pixels per meter of the car body drawing
+    float m_chassisScaleY;          // Vertical pixels per meter of the car body drawing
+    float m_wheelScale;             // Pixels per meter of the wheel drawing
+    qreal m_devicePixelRatio;       // Device pixel ratio the pixmaps were drawn at
+    QPixmap m_house;                // House, base and roof
+    QPointF m_houseOffset;          // Top left of m_house from the house's anchor on screen
+    QPixmap m_carBody;              // Car body
+    QPointF m_carBodyOffset;        // Top left of m_carBody from the chassis center on screen
+    QPixmap m_wheel;                // Tire, hub and center dot
+    QPointF m_wheelOffset;          // Top left of m_wheel from the wheel's center on screen
+
+    /**
+     * @brief Draws m_house at the current resolution
+     */
+    void drawHouseSprite();
+
+    /**
+     * @brief Draws m_carBody at the current resolution
+     */
+    void drawCarBodySprite();
+
+    /**
+     * @brief Draws m_wheel at the current resolution
+     */
+    void drawWheelSprite();
+
+public:
+
+    /**
+     * @brief Constructor. No pixmaps are drawn until a resolution is set.
+     */
+    StaticSprites();
+
+    /**
+     * @brief Sets the resolution the pixmaps are drawn at, redrawing those it changes
+     * @param scale Pixels per meter
+     * @param vehicle Vehicle being drawn; the drawings are made for the default car and
+     *        stretched to its chassis and wheel sizes
+     * @param devicePixelRatio Device pixel ratio of the widget painted on
+     */
+    void setResolution(float scale, const VehicleSpec &vehicle, qreal devicePixelRatio);
+
+    /**
+     * @brief Blits the house
+     * @param painter Painter with no transform, drawing in widget coordinates
+     * @param screenPos House anchor, one meter above the road, on screen
+     */
+    void drawHouse(QPainter &painter, const QPointF &screenPos) const;
+
+    /**
+     * @brief Blits the car body
+     * @param painter Painter with no transform, drawing in widget coordinates
+     * @param screenPos Chassis center on screen
+     */
+    void drawCarBody(QPainter &painter, const QPointF &screenPos) const;
+
+    /**
+     * @brief Blits a wheel
+     * @param painter Painter with no transform, drawing in widget coordinates
+     * @param screenPos Wheel center on screen
+     */
+    void drawWheel(QPainter &painter, const QPointF &screenPos) const;
+};
+
+#endif // STATICSPRITES_H
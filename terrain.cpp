@@ -0,0 +1,95 @@
+/**
+ * @file terrain.cpp
+ * @brief Implementation of the Terrain class
+ *
+ * @author Team AJKJ
+ */
+
+#include "terrain.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+Terrain::Terrain(b2World &world, const TerrainProfile &profile) : m_world(world),
+                                                                  m_profile(profile) { }
+
+Terrain::~Terrain()
+{
+    for (const Chunk &chunk : m_chunks) {
+        m_world.DestroyBody(chunk.body);
+    }
+}
+
+int Terrain::lastChunkIndex() const
+{
+    return m_profile.isEndless() ? -1 : (m_profile.vertexCount() - 2) / SegmentsPerChunk;
+}
+
+Terrain::Chunk Terrain::createChunk(int index) const
+{
+    Chunk chunk;
+    chunk.index = index;
+
+    // A chunk spans SegmentsPerChunk segments and shares its end vertices with its neighbours
+    int firstVertex = index * SegmentsPerChunk;
+    int lastVertex = firstVertex + SegmentsPerChunk;
+    if (!m_profile.isEndless()) {
+        lastVertex = std::min(lastVertex, m_profile.vertexCount() - 1);
+    }
+
+    std::vector<b2Vec2> vertices;
+    vertices.reserve(lastVertex - firstVertex + 1);
+    for (int i = firstVertex; i <= lastVertex; ++i) {
+        vertices.push_back(b2Vec2(m_profile.vertexX(i), m_profile.vertexHeight(i)));
+    }
+
+    b2BodyDef chunkBodyDef;
+    chunkBodyDef.position.Set(0.0f, 0.0f);
+    chunk.body = m_world.CreateBody(&chunkBodyDef);
+
+    // Ghost vertices make the seams between chunks as smooth as a single chain
+    b2ChainShape chain;
+    chain.CreateChain(vertices.data(), static_cast<int32>(vertices.size()));
+    if (firstVertex > 0) {
+        chain.SetPrevVertex(b2Vec2(m_profile.vertexX(firstVertex - 1), m_profile.vertexHeight(firstVertex - 1)));
+    }
+    if (m_profile.isEndless() || lastVertex < m_profile.vertexCount() - 1) {
+        chain.SetNextVertex(b2Vec2(m_profile.vertexX(lastVertex + 1), m_profile.vertexHeight(lastVertex + 1)));
+    }
+    chunk.body->CreateFixture(&chain, 0.0f);
+
+    return chunk;
+}
+
+void Terrain::update(float focusX)
+{
+    // Work out which chunks should be loaded around the focus point
+    int focusChunk = static_cast<int>(std::floor(focusX / (SegmentsPerChunk * m_profile.segmentWidth())));
+    int first = std::max(0, focusChunk - ChunkRadius);
+    int last = std::max(first, focusChunk + ChunkRadius);
+    if (!m_profile.isEndless()) {
+        last = std::min(last, lastChunkIndex());
+        first = std::min(first, last);
+    }
+
+    // Unload chunks that fell out of range
+    while (!m_chunks.empty() && m_chunks.front().index < first) {
+        m_world.DestroyBody(m_chunks.front().body);
+        m_chunks.pop_front();
+    }
+    while (!m_chunks.empty() && m_chunks.back().index > last) {
+        m_world.DestroyBody(m_chunks.back().body);
+        m_chunks.pop_back();
+    }
+
+    // Load the chunks that came into range
+    if (m_chunks.empty()) {
+        m_chunks.push_back(createChunk(first));
+    }
+    while (m_chunks.front().index > first) {
+        m_chunks.push_front(createChunk(m_chunks.front().index - 1));
+    }
+    while (m_chunks.back().index < last) {
+        m_chunks.push_back(createChunk(m_chunks.back().index + 1));
+    }
+}
@@ -0,0 +1,94 @@
+/**
+ * @file terrain.h
+ * @brief Defines the Terrain class that streams the road into the Box2D world in chunks
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef TERRAIN_H
+#define TERRAIN_H
+
+#include "terrainprofile.h"
+#include <box2d/box2d.h>
+#include <deque>
+
+/**
+ * @brief Streams the road described by a TerrainProfile into the physics world in
+ * fixed-width chunks around a focus point (the vehicle).
+ *
+ * Each chunk is its own static body with a b2ChainShape. Chunks are created as the
+ * focus approaches them and destroyed once it has left them behind, so only a bounded
+ * window of road exists in the physics world no matter how long the road is.
+ *
+ * Memory is bounded, but precision is not. Chunks, bodies and the camera all use
+ * absolute float world x with no floating origin. Float spacing stays below Box2D's
+ * 5 mm linear slop up to about 65 km (3.9 mm at 32-65 km). It reaches 7.8 mm by
+ * 131 km and 6 cm by 1000 km, enough to make contacts and the camera jitter. Roads
+ * are therefore held to TerrainProfile::MaxPreciseX (2^16 m): TerrainProfile cuts
+ * longer finite roads, and PhysicsWorld walls endless ones off there and keeps their
+ * hazards short of it.
+ */
+class Terrain {
+
+public:
+
+    /**
+     * @brief A loaded piece of road
+     */
+    struct Chunk {
+        int index;      // Chunk number along the road
+        b2Body *body;   // Static body holding the chain fixture
+    };
+
+    static const int SegmentsPerChunk = 16; // Road segments in one chunk
+    static const int ChunkRadius = 1;       // Chunks kept loaded either side of the focus chunk
+
+private:
+
+    b2World &m_world;                   // World the chunk bodies live in
+    const TerrainProfile &m_profile;    // Shape of the road
+    std::deque<Chunk> m_chunks;         // Loaded chunks, ordered by index
+
+    /**
+     * @brief Creates the body and chain fixture for one chunk
+     * @param index Chunk number
+     * @return The loaded chunk
+     */
+    Chunk createChunk(int index) const;
+
+    /**
+     * @brief Returns the index of the last chunk, or -1 if the road is endless
+     */
+    int lastChunkIndex() const;
+
+public:
+
+    /**
+     * @brief Constructor
+     * @param world Box2D world to stream the road into
+     * @param profile Shape of the road; must outlive the terrain
+     */
+    Terrain(b2World &world, const TerrainProfile &profile);
+
+    /**
+     * @brief Destructor destroys every loaded chunk body
+     */
+    ~Terrain();
+
+    Terrain(const Terrain&) = delete;
+    Terrain &operator=(const Terrain&) = delete;
+
+    /**
+     * @brief Loads chunks near the focus point and unloads ones that fell out of range.
+     *        Must not be called during b2World::Step.
+     * @param focusX World x coordinate to keep the road loaded around
+     */
+    void update(float focusX);
+
+    /**
+     * @brief Currently loaded chunks, ordered from left to right
+     */
+    const std::deque<Chunk> &chunks() const { return m_chunks; }
+};
+
+#endif // TERRAIN_H
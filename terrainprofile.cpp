@@ -0,0 +1,89 @@
+/**
+ * @file terrainprofile.cpp
+ * @brief Implementation of the TerrainProfile class
+ *
+ * @author Team AJKJ
+ */
+
+#include "terrainprofile.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+const float SegmentWidth = 10.0f;   // Distance between each x point
+
+// Y-coordinate changes (Δy) for each segment to create slope up and down.
+// Entry i is the change applied when reaching vertex i; the pattern repeats
+// along the whole road.
+const int PatternLength = 10;
+const float PatternDeltaY[PatternLength] = {
+    0.0f,
+    0.5f,
+    1.0f,
+    1.2f,
+    1.0f,
+    -0.5f,
+    -1.0f,
+    -0.8f,
+    -0.5f,
+    -0.9f
+};
+
+} // namespace
+
+TerrainProfile::TerrainProfile(int vertexCount) : m_vertexCount(vertexCount == Endless ? Endless : std::min(vertexCount, maxVertexCount())),
+                                                  m_segmentWidth(SegmentWidth),
+                                                  m_startY(-2.0f),         // Initial y-position of the road
+                                                  m_patternRise(0.0f),
+                                                  m_patternHeights(PatternLength),
+                                                  m_patternSlopes(PatternLength) {
+
+    // Accumulate y within one period of the pattern
+    float height = 0.0f;
+    for (int i = 0; i < PatternLength; ++i) {
+        height += PatternDeltaY[i];
+        m_patternHeights[i] = height;
+    }
+    m_patternRise = height;
+
+    // Segment i rises by the delta of the vertex it ends on
+    for (int i = 0; i < PatternLength; ++i) {
+        m_patternSlopes[i] = PatternDeltaY[(i + 1) % PatternLength] / m_segmentWidth;
+    }
+}
+
+int TerrainProfile::maxVertexCount()
+{
+    return static_cast<int>(MaxPreciseX / SegmentWidth) + 1;
+}
+
+float TerrainProfile::vertexHeight(int vertexIndex) const
+{
+    return m_startY + (vertexIndex / PatternLength) * m_patternRise
+           + m_patternHeights[vertexIndex % PatternLength];
+}
+
+int TerrainProfile::segmentIndexAt(float x) const
+{
+    int segmentIndex = std::max(0, static_cast<int>(std::floor(x / m_segmentWidth)));
+    if (!isEndless()) {
+        segmentIndex = std::min(segmentIndex, m_vertexCount - 2);
+    }
+    return segmentIndex;
+}
+
+float TerrainProfile::heightAt(float x) const
+{
+    int segmentIndex = segmentIndexAt(x);
+    float t = (x - vertexX(segmentIndex)) / m_segmentWidth;
+    t = std::min(std::max(t, 0.0f), 1.0f);
+
+    float startY = vertexHeight(segmentIndex);
+    return startY + t * (vertexHeight(segmentIndex + 1) - startY);
+}
+
+float TerrainProfile::slopeAt(float x) const
+{
+    return m_patternSlopes[segmentIndexAt(x) % PatternLength];
+}
@@ -0,0 +1,107 @@
+/**
+ * @file terrainprofile.h
+ * @brief Defines the TerrainProfile class that describes the shape of the road
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef TERRAINPROFILE_H
+#define TERRAINPROFILE_H
+
+#include <vector>
+
+/**
+ * @brief Height field of the road, built once per level and shared by physics, hazard
+ * placement and rendering.
+ *
+ * The road repeats a fixed slope pattern, so the profile only stores prefix-summed vertex
+ * heights and segment slopes for one period of the pattern. Any vertex height, or the
+ * interpolated height and slope at any x, is then an O(1) lookup with bounded memory,
+ * however long the road is.
+ */
+class TerrainProfile {
+
+public:
+
+    static const int Endless = 0;   // Vertex count meaning "no end to the road"
+    static constexpr float MaxPreciseX = 65536.0f;  // Farthest world x (2^16 m) where float spacing stays under Box2D's linear slop
+
+private:
+
+    int m_vertexCount;                  // Total road vertices, or Endless
+    float m_segmentWidth;               // Horizontal distance between vertices
+    float m_startY;                     // Height the road starts from
+    float m_patternRise;                // Height gained over one full repetition of the pattern
+    std::vector<float> m_patternHeights; // Prefix-summed vertex heights within one pattern period
+    std::vector<float> m_patternSlopes;  // Slope (dy/dx) of each segment within one pattern period
+
+public:
+
+    /**
+     * @brief Constructor builds the prefix sums
+     * @param vertexCount Total number of road vertices, or TerrainProfile::Endless. Finite
+     *        roads are cut to maxVertexCount() so they end within MaxPreciseX.
+     */
+    explicit TerrainProfile(int vertexCount);
+
+    /**
+     * @brief Most vertices a finite road can have and still end within MaxPreciseX
+     */
+    static int maxVertexCount();
+
+    /**
+     * @brief Height of the road at a vertex
+     * @param vertexIndex Vertex index (must not be negative)
+     * @return World y coordinate of the vertex
+     */
+    float vertexHeight(int vertexIndex) const;
+
+    /**
+     * @brief Index of the segment under a world x coordinate, clamped to the road
+     * @param x World x coordinate
+     * @return Segment index (segment i joins vertex i and i + 1)
+     */
+    int segmentIndexAt(float x) const;
+
+    /**
+     * @brief Height of the road surface at a world x coordinate
+     * @param x World x coordinate
+     * @return Interpolated road height
+     */
+    float heightAt(float x) const;
+
+    /**
+     * @brief Slope of the road surface at a world x coordinate
+     * @param x World x coordinate
+     * @return dy/dx of the segment under x (positive is uphill when driving right)
+     */
+    float slopeAt(float x) const;
+
+    /**
+     * @brief World x coordinate of a vertex
+     * @param vertexIndex Vertex index
+     */
+    float vertexX(int vertexIndex) const { return vertexIndex * m_segmentWidth; }
+
+    /**
+     * @brief Horizontal distance between road vertices
+     */
+    float segmentWidth() const { return m_segmentWidth; }
+
+    /**
+     * @brief Total number of road vertices, or TerrainProfile::Endless
+     */
+    int vertexCount() const { return m_vertexCount; }
+
+    /**
+     * @brief Whether the road goes on forever
+     */
+    bool isEndless() const { return m_vertexCount == Endless; }
+
+    /**
+     * @brief World x coordinate of the last road vertex (meaningless for endless roads)
+     */
+    float endX() const { return (m_vertexCount - 1) * m_segmentWidth; }
+};
+
+#endif // TERRAINPROFILE_H
@@ -0,0 +1,42 @@
+# Headless tests for PhysicsWorld, save-states and recordings. Like simrunner they use
+# QtCore only, so they run without a display: qmake && make && ./tests
+
+QT       = core testlib
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tests
+
+include(../Box2D.pri)
+
+INCLUDEPATH += $$PWD/..
+
+SOURCES += \
+    tst_simulation.cpp \
+    ../contactevents.cpp \
+    ../hazardplacer.cpp \
+    ../hazardstore.cpp \
+    ../inputrecording.cpp \
+    ../physicsworld.cpp \
+    ../plantcatalog.cpp \
+    ../randomgenerator.cpp \
+    ../savestate.cpp \
+    ../terrain.cpp \
+    ../terrainprofile.cpp \
+    ../vehicle.cpp \
+    ../vehiclespec.cpp
+
+HEADERS += \
+    ../contactevents.h \
+    ../hazardplacer.h \
+    ../hazardstore.h \
+    ../inputrecording.h \
+    ../physicsworld.h \
+    ../plantcatalog.h \
+    ../randomgenerator.h \
+    ../savestate.h \
+    ../terrain.h \
+    ../terrainprofile.h \
+    ../vehicle.h \
+    ../vehiclespec.h
@@ -0,0 +1,192 @@
+/**
+ * @file tst_simulation.cpp
+ * @brief Headless tests for save-states, recordings and level generation
+ *
+ * @author Team AJKJ
+ */
+
+#include "gamemanager.h"
+#include "inputrecording.h"
+#include "physicsworld.h"
+#include "savestate.h"
+#include "vehicle.h"
+#include <QTemporaryDir>
+#include <QtTest>
+
+/**
+ * @brief Tests of the simulation code that needs no window
+ */
+class SimulationTest : public QObject {
+    Q_OBJECT
+
+private:
+
+    /**
+     * @brief Writes a save-state of a freshly built world
+     * @param path File to write
+     * @param gameState GameState to save
+     * @param level Level number to save
+     * @return True if the file was written
+     */
+    static bool writeSave(const QString &path, int gameState, int level);
+
+    /**
+     * @brief Drives a world for a number of steps, alternating forward and back every second
+     * @param world World to step
+     * @param steps Number of steps to take
+     * @param recorder Recorder to record the drive forces in, or nullptr
+     */
+    static void drive(PhysicsWorld &world, int steps, InputRecorder *recorder);
+
+private slots:
+
+    void acceptsSaveOnValidLevel();
+    void rejectsSaveOnBadLevel_data();
+    void rejectsSaveOnBadLevel();
+    void rejectsHazardsOutOfOrder();
+    void replaysRecordingMadeAfterRestart();
+    void keepsEndlessHazardsWithinPreciseRoad();
+    void cutsRoadsAtPreciseLimit();
+};
+
+bool SimulationTest::writeSave(const QString &path, int gameState, int level)
+{
+    PhysicsWorld world(15, 1);
+    SavedProgress progress = {};
+    progress.gameState = gameState;
+    progress.level = level;
+    return SaveState::write(path, world, progress);
+}
+
+void SimulationTest::drive(PhysicsWorld &world, int steps, InputRecorder *recorder)
+{
+    Vehicle *vehicle = world.getVehicle();
+    for (int i = 0; i < steps; ++i) {
+        float force = (i / 60) % 2 == 0 ? vehicle->spec().driveForce : -vehicle->spec().driveForce;
+        if (recorder) {
+            recorder->record(world, force);
+        }
+        vehicle->applyDriveForce(force);
+        world.step();
+    }
+}
+
+void SimulationTest::acceptsSaveOnValidLevel()
+{
+    QTemporaryDir directory;
+    QString path = directory.filePath("valid.sav");
+    QVERIFY(writeSave(path, Level3, 3));
+
+    SaveState save;
+    QVERIFY(save.open(path));
+    QCOMPARE(save.header().progress.level, 3);
+}
+
+void SimulationTest::rejectsSaveOnBadLevel_data()
+{
+    QTest::addColumn<int>("gameState");
+    QTest::addColumn<int>("level");
+
+    QTest::newRow("level 0") << static_cast<int>(GameOver) << 0;
+    QTest::newRow("level past the last") << static_cast<int>(GameOver) << GameManager::LevelCount + 1;
+    QTest::newRow("negative level") << static_cast<int>(MainMenu) << -1;
+    QTest::newRow("state on another level") << static_cast<int>(Level2) << 1;
+    QTest::newRow("state past the enum") << static_cast<int>(GameClear) + 1 << 1;
+    QTest::newRow("negative state") << -1 << 1;
+}
+
+void SimulationTest::rejectsSaveOnBadLevel()
+{
+    QFETCH(int, gameState);
+    QFETCH(int, level);
+
+    QTemporaryDir directory;
+    QString path = directory.filePath("bad.sav");
+    QVERIFY(writeSave(path, gameState, level));
+
+    SaveState save;
+    QVERIFY(!save.open(path));
+}
+
+void SimulationTest::rejectsHazardsOutOfOrder()
+{
+    PhysicsWorld world(15, 1);
+    SavedWorld saved;
+    std::vector<SavedHazard> hazards;
+    world.saveState(saved, hazards);
+    QVERIFY(hazards.size() >= 2);
+    QVERIFY(world.validateState(saved, hazards.data(), static_cast<uint32_t>(hazards.size())));
+
+    std::swap(hazards[0], hazards[1]);
+    QVERIFY(!world.validateState(saved, hazards.data(), static_cast<uint32_t>(hazards.size())));
+    QVERIFY(!world.loadState(saved, hazards.data(), static_cast<uint32_t>(hazards.size())));
+}
+
+void SimulationTest::replaysRecordingMadeAfterRestart()
+{
+    const int steps = 600;
+
+    // Record the way the game does: on a world that has already been played, after
+    // restarting the level
+    PhysicsWorld played(15, 7);
+    drive(played, 300, nullptr);
+    played.rebuild(played.seed());
+
+    InputRecorder recorder;
+    recorder.start(played);
+    drive(played, steps, &recorder);
+    recorder.stop(played);
+
+    QTemporaryDir directory;
+    QString path = directory.filePath("restart.rec");
+    QVERIFY(recorder.write(path));
+
+    // Replay the way simrunner does: into a world built from the recorded seed
+    InputReplay replay;
+    QVERIFY(replay.open(path));
+    PhysicsWorld fresh(replay.header().hazardCount, replay.header().seed, replay.header().roadPointCount);
+    fresh.setQuality(static_cast<PhysicsQuality>(replay.header().quality));
+    replay.begin(fresh);
+    while (!replay.finished(fresh)) {
+        replay.applyInputs(fresh);
+        fresh.step();
+    }
+
+    // Bit for bit, not approximately
+    for (int i = 0; i < 3; ++i) {
+        b2Body *expected = (i == 0) ? played.getVehicle()->getChassis() : played.getVehicle()->getWheel(i - 1);
+        b2Body *actual = (i == 0) ? fresh.getVehicle()->getChassis() : fresh.getVehicle()->getWheel(i - 1);
+        QVERIFY(actual->GetPosition() == expected->GetPosition());
+        QVERIFY(actual->GetAngle() == expected->GetAngle());
+        QVERIFY(actual->GetLinearVelocity() == expected->GetLinearVelocity());
+    }
+    QCOMPARE(fresh.hazardCount(), played.hazardCount());
+}
+
+void SimulationTest::keepsEndlessHazardsWithinPreciseRoad()
+{
+    // Enough hazards that a regular level's spacing would run past the precision limit
+    const int hazardCount = 2000;
+    PhysicsWorld world(hazardCount, 3, TerrainProfile::Endless);
+
+    const HazardStore &hazards = world.getHazards();
+    QCOMPARE(static_cast<int>(hazards.size()) + world.unplacedHazardCount(), hazardCount);
+    QVERIFY(hazards.size() > 0);
+    for (b2Body *body : hazards.bodies()) {
+        QVERIFY(body->GetPosition().x <= TerrainProfile::MaxPreciseX);
+    }
+}
+
+void SimulationTest::cutsRoadsAtPreciseLimit()
+{
+    PhysicsWorld world(15, 1, 100000);
+
+    const TerrainProfile &profile = world.getTerrainProfile();
+    QCOMPARE(profile.vertexCount(), TerrainProfile::maxVertexCount());
+    QVERIFY(profile.endX() <= TerrainProfile::MaxPreciseX);
+    QVERIFY(profile.endX() + profile.segmentWidth() > TerrainProfile::MaxPreciseX);
+}
+
+QTEST_APPLESS_MAIN(SimulationTest)
+
+#include "tst_simulation.moc"
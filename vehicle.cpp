@@ -9,8 +9,8 @@
 
 #include "vehicle.h"
 
-Vehicle::Vehicle(b2World &world, const b2Vec2 &position)
-    : m_chassis(nullptr), m_wheels{nullptr, nullptr}, m_wheelJoints{nullptr, nullptr} {
+Vehicle::Vehicle(b2World &world, const b2Vec2 &position, const VehicleSpec &spec)
+    : m_chassis(nullptr), m_wheels{nullptr, nullptr}, m_wheelJoints{nullptr, nullptr}, m_spec(spec) {
 
     // Create Chassis
     b2BodyDef chassisBodyDef;
@@ -21,25 +21,25 @@ Vehicle::Vehicle(b2World &world, const b2Vec2 &position)
 
     // Define chassis shape as a box
     b2PolygonShape chassisShape;
-    chassisShape.SetAsBox(1.2f, 0.3f);
+    chassisShape.SetAsBox(spec.chassisHalfWidth, spec.chassisHalfHeight);
 
     // Set physical properties for chassis
     b2FixtureDef chassisFixture;
     chassisFixture.shape = &chassisShape;
-    chassisFixture.density = 1.5f;
-    chassisFixture.friction = 1.0f;
+    chassisFixture.density = spec.chassisDensity;
+    chassisFixture.friction = spec.chassisFriction;
     m_chassis->CreateFixture(&chassisFixture);
 
     // --- Create Wheels ---
-    float wheelRadius = 0.15f;       // Radius of the wheels
-    float axleOffsetY = -0.4f;       // Vertical offset from the chassis to the axle
+    float wheelRadius = spec.wheelRadius;    // Radius of the wheels
+    float axleOffsetY = spec.axleOffsetY;    // Vertical offset from the chassis to the axle
 
     // Create left and right wheels
     for (int i = 0; i < 2; ++i) {    // Loop for left (0) and right (1) wheels
         b2BodyDef wheelBodyDef;
         wheelBodyDef.type = b2_dynamicBody;  // Wheels are dynamic (can move and rotate)
 
-        wheelBodyDef.position = position + b2Vec2((i == 0 ? -0.9f : 0.9f), axleOffsetY);
+        wheelBodyDef.position = position + b2Vec2((i == 0 ? -spec.axleOffsetX : spec.axleOffsetX), axleOffsetY);
 
         // Create the wheel body in the Box2D world
         m_wheels[i] = world.CreateBody(&wheelBodyDef);
@@ -51,28 +51,32 @@ Vehicle::Vehicle(b2World &world, const b2Vec2 &position)
         // Create the fixture (physical properties) for the wheel
         b2FixtureDef wheelFixture;
         wheelFixture.shape = &wheelShape;
-        wheelFixture.density = 1.0f;     // Mass density
-        wheelFixture.friction = 2.0f;    // High friction for better traction
+        wheelFixture.density = spec.wheelDensity;     // Mass density
+        wheelFixture.friction = spec.wheelFriction;   // High friction for better traction
         m_wheels[i]->CreateFixture(&wheelFixture);
 
-        // Define the joint that connects the wheel to the chassis
-        b2WheelJointDef jointDef;
-        jointDef.bodyA = m_chassis;       // Chassis is the base
-        jointDef.bodyB = m_wheels[i];     // Wheel is the connected body
-        jointDef.localAnchorA.Set((i == 0 ? -0.9f : 0.9f), axleOffsetY);  // Mounting point on chassis
-        jointDef.localAnchorB.SetZero();  // Mounting point on wheel (center)
-        jointDef.localAxisA.Set(0.0f, 1.0f); // Axis of suspension (vertical)
-
-        // Enable motor to allow driving control
-        jointDef.enableMotor = true;
-        jointDef.motorSpeed = 0.0f;           // Initial speed is 0
-        jointDef.maxMotorTorque = 100.0f;     // Maximum force to apply from motor
-
-        // Create the joint in the Box2D world and store it
-        m_wheelJoints[i] = (b2WheelJoint*)world.CreateJoint(&jointDef);
+        createWheelJoint(i);
     }
 }
 
+void Vehicle::createWheelJoint(int index) {
+    // Define the joint that connects the wheel to the chassis
+    b2WheelJointDef jointDef;
+    jointDef.bodyA = m_chassis;       // Chassis is the base
+    jointDef.bodyB = m_wheels[index];     // Wheel is the connected body
+    jointDef.localAnchorA.Set((index == 0 ? -m_spec.axleOffsetX : m_spec.axleOffsetX), m_spec.axleOffsetY);  // Mounting point on chassis
+    jointDef.localAnchorB.SetZero();  // Mounting point on wheel (center)
+    jointDef.localAxisA.Set(0.0f, 1.0f); // Axis of suspension (vertical)
+
+    // Enable motor to allow driving control
+    jointDef.enableMotor = true;
+    jointDef.motorSpeed = 0.0f;           // Initial speed is 0
+    jointDef.maxMotorTorque = m_spec.maxMotorTorque; // Maximum force to apply from motor
+
+    // Create the joint in the Box2D world and store it
+    m_wheelJoints[index] = m_chassis->GetWorld()->CreateJoint(&jointDef);
+}
+
 void Vehicle::applyDriveForce(float force) {
     // Apply horizontal force to both wheels
     for (int i = 0; i < 2; ++i) {
@@ -88,24 +92,48 @@ b2Body* Vehicle::getWheel(int index) const {
     return (index >= 0 && index < 2) ? m_wheels[index] : nullptr;
 }
 
+b2WheelJoint* Vehicle::getWheelJoint(int index) const {
+    return (index >= 0 && index < 2) ? static_cast<b2WheelJoint*>(m_wheelJoints[index]) : nullptr;
+}
+
 void Vehicle::reset(const b2Vec2& position) {
 
-    const float forwardOffset = 2.0f; // Offset for placing vehicle slightly forward
-    b2Vec2 newPosition(position.x + forwardOffset, position.y);
+    // Use the same layout as the constructor so a reset vehicle matches a new one
+    b2Vec2 newPosition = position;
 
     // Reset chassis position and velocity
     m_chassis->SetTransform(newPosition, 0.0f);
     m_chassis->SetLinearVelocity(b2Vec2_zero);
     m_chassis->SetAngularVelocity(0.0f);
+    m_chassis->SetAwake(true);
 
     // Reset each whoeel position and velocity
     for (int i = 0; i < 2; ++i) {
         b2Vec2 wheelPos = newPosition;
-        wheelPos.x += (i == 0 ? -0.9f : 0.9f);
-        wheelPos.y -= 0.4f;
+        wheelPos.x += (i == 0 ? -m_spec.axleOffsetX : m_spec.axleOffsetX);
+        wheelPos.y += m_spec.axleOffsetY;
 
         m_wheels[i]->SetTransform(wheelPos, 0.0f);
         m_wheels[i]->SetLinearVelocity(b2Vec2_zero);
         m_wheels[i]->SetAngularVelocity(0.0f);
+        m_wheels[i]->SetAwake(true);
+    }
+}
+
+void Vehicle::resetSolverState() {
+    // Rebuild both joints in their original order so the world's joint list matches a new vehicle
+    b2World *world = m_chassis->GetWorld();
+    for (int i = 0; i < 2; ++i) {
+        world->DestroyJoint(m_wheelJoints[i]);
+    }
+    for (int i = 0; i < 2; ++i) {
+        createWheelJoint(i);
+    }
+
+    // Deactivating a body destroys its contacts; they are found again on the next step
+    b2Body *bodies[] = {m_chassis, m_wheels[0], m_wheels[1]};
+    for (b2Body *body : bodies) {
+        body->SetActive(false);
+        body->SetActive(true);
     }
 }
@@ -11,6 +11,7 @@
 #define VEHICLE_H
 
 #include <box2d/box2d.h>
+#include "vehiclespec.h"
 
 /**
  * @brief Represents a simple two-wheeled vehicle with drive functionality.
@@ -22,6 +23,13 @@ private:
     b2Body *m_chassis;          // The main body of the vehicle
     b2Body *m_wheels[2];        // Wheels: index 0 = front, index 1 = rear
     b2Joint *m_wheelJoints[2];  // Joints connecting wheels to chassis
+    VehicleSpec m_spec;         // Dimensions, mass, grip and drive the vehicle was built with
+
+    /**
+     * @brief Creates the joint between the chassis and one wheel, motor stopped
+     * @param index Wheel index (0 = left, 1 = right)
+     */
+    void createWheelJoint(int index);
 
 public:
 
@@ -29,8 +37,9 @@ public:
      * @brief Constructor: creates the chassis and wheels at the given position
      * @param world Box2D world where the vehicle will be created
      * @param position Initial position for the vehicle
+     * @param spec Dimensions, mass, grip and drive; must be valid
      */
-    Vehicle(b2World &world, const b2Vec2 &position);
+    Vehicle(b2World &world, const b2Vec2 &position, const VehicleSpec &spec = VehicleSpec());
 
     /**
      * @brief Applies horizontal drive force to the wheels
@@ -51,12 +60,33 @@ public:
      */
     b2Body *getWheel(int index) const;
 
+    /**
+     * @brief Accessor for the joint connecting a wheel to the chassis
+     * @param index Wheel index (0 = left, 1 = right)
+     * @return Pointer to the wheel joint
+     */
+    b2WheelJoint *getWheelJoint(int index) const;
+
+    /**
+     * @brief Accessor for the definition the vehicle was built from
+     * @return Vehicle definition
+     */
+    const VehicleSpec &spec() const { return m_spec; }
+
     /**
      * @brief Resets the vehicle to a specific position
      * @param position New position for the vehicle
      */
     void reset(const b2Vec2& position);
 
+    /**
+     * @brief Drops what Box2D's solver carries over between steps for the vehicle: the
+     *        wheel joints are rebuilt, which clears their accumulated impulses and stops
+     *        the motors, and the vehicle's contacts are destroyed, which clears their
+     *        warm-start impulses. Must not be called during b2World::Step.
+     */
+    void resetSolverState();
+
 };
 
 #endif // VEHICLE_H
@@ -0,0 +1,82 @@
+/**
+ * @file vehiclespec.cpp
+ * @brief Implementation of VehicleSpec loading and validation
+ *
+ * @author Team AJKJ
+ */
+
+#include "vehiclespec.h"
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+namespace {
+
+struct SpecMember {
+    const char *name;
+    float VehicleSpec::*member;
+};
+
+// Definition file keys, in declaration order
+const SpecMember SpecMembers[] = {
+    {"chassisHalfWidth", &VehicleSpec::chassisHalfWidth},
+    {"chassisHalfHeight", &VehicleSpec::chassisHalfHeight},
+    {"chassisDensity", &VehicleSpec::chassisDensity},
+    {"chassisFriction", &VehicleSpec::chassisFriction},
+    {"wheelRadius", &VehicleSpec::wheelRadius},
+    {"wheelDensity", &VehicleSpec::wheelDensity},
+    {"wheelFriction", &VehicleSpec::wheelFriction},
+    {"axleOffsetX", &VehicleSpec::axleOffsetX},
+    {"axleOffsetY", &VehicleSpec::axleOffsetY},
+    {"maxMotorTorque", &VehicleSpec::maxMotorTorque},
+    {"driveForce", &VehicleSpec::driveForce},
+};
+
+} // namespace
+
+float VehicleSpec::*VehicleSpec::member(const QString &name)
+{
+    for (const SpecMember &specMember : SpecMembers) {
+        if (name == QLatin1String(specMember.name)) {
+            return specMember.member;
+        }
+    }
+    return nullptr;
+}
+
+bool VehicleSpec::isValid() const
+{
+    return chassisHalfWidth > 0.0f && chassisHalfHeight > 0.0f && chassisDensity > 0.0f &&
+           chassisFriction >= 0.0f && wheelRadius > 0.0f && wheelDensity > 0.0f &&
+           wheelFriction >= 0.0f && axleOffsetX > 0.0f && maxMotorTorque >= 0.0f &&
+           driveForce >= 0.0f;
+}
+
+bool VehicleSpec::load(const QString &path, VehicleSpec &spec)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QJsonDocument document = QJsonDocument::fromJson(file.readAll());
+    if (!document.isObject()) {
+        return false;
+    }
+
+    // Unknown keys are rejected rather than ignored so a misspelt key is not silently lost
+    VehicleSpec loaded;
+    QJsonObject object = document.object();
+    for (auto it = object.begin(); it != object.end(); ++it) {
+        float VehicleSpec::*target = member(it.key());
+        if (!target || !it.value().isDouble()) {
+            return false;
+        }
+        loaded.*target = static_cast<float>(it.value().toDouble());
+    }
+    if (!loaded.isValid()) {
+        return false;
+    }
+
+    spec = loaded;
+    return true;
+}
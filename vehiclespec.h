@@ -0,0 +1,55 @@
+/**
+ * @file vehiclespec.h
+ * @brief Defines the VehicleSpec that describes a vehicle's shape, mass, grip and drive
+ *
+ * @author Team AJKJ
+ */
+
+#ifndef VEHICLESPEC_H
+#define VEHICLESPEC_H
+
+#include <QString>
+
+/**
+ * @brief Everything Vehicle needs to build a car, loadable from a JSON definition file.
+ *
+ * A definition file is one JSON object whose keys are the member names below, e.g.
+ * {"wheelRadius": 0.2, "driveForce": 80}. Keys left out keep their default, so the
+ * defaults are the game's original car.
+ */
+struct VehicleSpec {
+    float chassisHalfWidth = 1.2f;      // Half the chassis box's width in metres
+    float chassisHalfHeight = 0.3f;     // Half the chassis box's height in metres
+    float chassisDensity = 1.5f;        // Chassis mass density
+    float chassisFriction = 1.0f;       // Chassis friction
+    float wheelRadius = 0.15f;          // Radius of both wheels in metres
+    float wheelDensity = 1.0f;          // Wheel mass density
+    float wheelFriction = 2.0f;         // Wheel friction; high for traction
+    float axleOffsetX = 0.9f;           // Horizontal distance from the chassis centre to each axle
+    float axleOffsetY = -0.4f;          // Vertical offset from the chassis centre to the axles
+    float maxMotorTorque = 100.0f;      // Maximum torque of each wheel joint's motor
+    float driveForce = 60.0f;           // Force the arrow keys apply to each wheel
+
+    /**
+     * @brief Looks up a member by its name in definition files
+     * @param name Member name, e.g. "wheelRadius"
+     * @return Pointer to the member, or nullptr if there is no member by that name
+     */
+    static float VehicleSpec::*member(const QString &name);
+
+    /**
+     * @brief Returns whether the values can build a working car: sizes, densities and the
+     *        axle spacing positive, friction, torque and drive force not negative
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Reads a definition file on top of the defaults
+     * @param path File to read
+     * @param spec Receives the definition; left untouched if the file is rejected
+     * @return True if the file was read, has only known numeric keys and is valid
+     */
+    static bool load(const QString &path, VehicleSpec &spec);
+};
+
+#endif // VEHICLESPEC_H
@@ -20,18 +20,62 @@
 #include <QPixmap>
 #include <QDebug>
 #include <QPointer>
-#include <random>
+#include <QDir>
+#include <QStandardPaths>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+// Generous bounds of what is drawn around an anchor point, for culling against the view
+const float HouseHalfWidth = 2.0f;      // Base and roof overhang either side of the house's x
+const float HouseBelow = 1.0f;          // Base below the house's anchor point
+const float HouseAbove = 4.5f;          // Base and roof above the house's anchor point
+const float PlantExtent = 2.0f;         // Blades in any direction from the plant's root
+
+/**
+ * @brief Reads the game's vehicle definition, falling back to the built-in car
+ */
+VehicleSpec gameVehicleSpec()
+{
+    const QString path = ":/vehicles/Vehicles/default.json";
+    VehicleSpec spec;
+    if (!VehicleSpec::load(path, spec)) {
+        qWarning() << "Could not read vehicle definition" << path << "- using the built-in car";
+    }
+    return spec;
+}
+
+} // namespace
 
 WorldRenderer::WorldRenderer(QWidget *parent) : QWidget(parent),
-                                                m_physicsWorld(new PhysicsWorld(15)), // Limit to 15 plants
+                                                m_physicsWorld(new PhysicsWorld(15, // Limit to 15 plants
+                                                                                PhysicsWorld::randomSeed(),
+                                                                                PhysicsWorld::DefaultRoadPointCount,
+                                                                                gameVehicleSpec())),
                                                 m_scale(50.0f), // 50 pixels per meter
-                                                m_background(":/images/Plants/Images/background.jpg") {
+                                                m_road(&m_physicsWorld->getTerrainProfile()),
+                                                m_plantsByXVersion(UINT64_MAX) {
+    // The scenery scrolls with the world
+    m_background.addLayer(QPixmap(":/images/Plants/Images/background.jpg"), 1.0f);
+
     // Initialize GameManager
     m_gameManager = new GameManager(this);
 
     // Register custom contact listener to handle game logic on collisions
+    // The physics world owns the listener and deletes it with itself
     m_contactListener = new GameContactListener(m_gameManager, m_physicsWorld);
-    m_physicsWorld->getWorld().SetContactListener(m_contactListener);
+    m_physicsWorld->setContactHandler(m_contactListener);
+
+    // Physics steps on its own thread, and only while the game is in a level
+    m_physicsThread = new PhysicsThread(m_physicsWorld, m_contactListener, this);
+    connect(m_physicsThread, &PhysicsThread::reachedEnd, this, &WorldRenderer::handleReachedEnd);
+    connect(m_gameManager, &GameManager::stateChanged, this, [this](GameState state) {
+        m_physicsThread->setLevelActive(state == Level1 || state == Level2 || state == Level3);
+    });
+    m_physicsThread->start();
+    m_physicsThread->resume();
 
     // Configure and start a timer to refresh screen at ~60 FPS
     m_timer = new QTimer(this);
@@ -51,6 +95,9 @@ WorldRenderer::~WorldRenderer()
         m_timer->stop();
         delete m_timer;
     }
+
+    // The thread must be gone before the world it steps
+    delete m_physicsThread;
     delete m_physicsWorld;
 }
 
@@ -66,10 +113,17 @@ void WorldRenderer::paintEvent(QPaintEvent *event)
     painter.setPen(Qt::white);
     painter.setBrush(Qt::NoBrush);
 
-    // Camera follows the vehicle's chassis
-    Vehicle *vehicle = m_physicsWorld->getVehicle();
-    b2Body *chassis = vehicle->getChassis();
-    b2Vec2 camCenter = chassis->GetPosition();
+    // Draw the newest step the physics thread has published, blended with the one before
+    // by how far into the next step the wall clock is
+    const RenderSnapshot &snapshot = m_physicsThread->latestSnapshot();
+    int64_t nowNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    float alpha = static_cast<float>((nowNs - snapshot.publishedNs) / (m_physicsWorld->timeStep() * 1.0e9));
+    alpha = std::clamp(alpha, 0.0f, 1.0f);
+
+    // Camera follows the vehicle's chassis, interpolated between the last two physics steps
+    BodyState chassisState = interpolatedState(snapshot, 0, alpha);
+    b2Vec2 camCenter = chassisState.position;
     float cameraYOffset = 4.0f;
 
     // Define a lambda for world-to-screen conversion with camera offset
@@ -78,230 +132,83 @@ void WorldRenderer::paintEvent(QPaintEvent *event)
                        height() / 2 - ((worldPos.y - camCenter.y - cameraYOffset) * m_scale));
     };
 
-    // draw background
-    if (!m_background.isNull()) {
-        int bgWidth = m_background.width();
-        float offsetX = chassis->GetPosition().x * m_scale;
-        int startX = -static_cast<int>(offsetX) % bgWidth - bgWidth;
+    // Part of the world the widget shows; anything outside it is not submitted for drawing
+    float halfViewWidth = width() / 2.0f / m_scale;
+    float halfViewHeight = height() / 2.0f / m_scale;
+    float viewLeft = camCenter.x - halfViewWidth;
+    float viewRight = camCenter.x + halfViewWidth;
+    float viewBottom = camCenter.y + cameraYOffset - halfViewHeight;
+    float viewTop = camCenter.y + cameraYOffset + halfViewHeight;
 
-        for (int x = startX; x < width(); x += bgWidth) {
-            painter.drawPixmap(x, 0, bgWidth, height(), m_background);
-        }
-    }
+    // draw background
+    m_background.draw(painter, size(), devicePixelRatioF(), camCenter.x * m_scale);
 
     // --- Draw Road ---
-    QPainterPath roadPath;
-    QPainterPath filledRoadPath;
-    QVector<QPointF> upperPoints;
-
-    // Get the list of bodies in the Box2D world
-    const auto& roadBody = m_physicsWorld->getWorld().GetBodyList();
-
-    // Loop through all bodies in the world
-    for (b2Body* body = roadBody; body; body = body->GetNext()) {
-        // Loop through all fixtures of the body
-        for (b2Fixture* f = body->GetFixtureList(); f; f = f->GetNext()) {
-            // Check if the fixture is a chain shape (used for the road)
-            if (f->GetType() == b2Shape::e_chain) {
-                b2ChainShape* chain = static_cast<b2ChainShape*>(f->GetShape());
-
-                // If the chain has points, start drawing
-                if (chain->m_count > 0) {
-                    QPointF firstPoint = worldToScreenCamera(chain->m_vertices[0]);
-                    upperPoints.append(firstPoint);
-
-                    // Move to the first point of the chain
-                    roadPath.moveTo(firstPoint);
-                    filledRoadPath.moveTo(firstPoint);
-
-                    // Connect lines to each subsequent point
-                    for (int i = 1; i < chain->m_count; ++i) {
-                        QPointF point = worldToScreenCamera(chain->m_vertices[i]);
-                        roadPath.lineTo(point);
-                        filledRoadPath.lineTo(point);
-                        upperPoints.append(point);
-                    }
-                }
-            }
-        }
-    }
+    // The road is cached in world coordinates; only the camera transform changes per frame
+    QTransform camera;
+    camera.translate(width() / 2.0, height() / 2.0);
+    camera.scale(m_scale, -m_scale);
+    camera.translate(-camCenter.x, -(camCenter.y + cameraYOffset));
 
-    if (!upperPoints.isEmpty()) {
-        QPointF lastPoint = upperPoints.last();
-        QPointF bottomRight = QPointF(lastPoint.x(), height());
-        filledRoadPath.lineTo(bottomRight);
+    const TerrainProfile &profile = m_physicsWorld->getTerrainProfile();
 
-        QPointF bottomLeft = QPointF(upperPoints.first().x(), height());
-        filledRoadPath.lineTo(bottomLeft);
-
-        filledRoadPath.lineTo(upperPoints.first());
-    }
-
-    // Draw the filled road
     QBrush roadBrush(QColor(210, 180, 140));
 
     painter.setPen(Qt::NoPen);
     painter.setBrush(roadBrush);
-    painter.drawPath(filledRoadPath);
+    painter.setTransform(camera);
+    m_road.draw(painter, viewLeft, viewRight);
+    painter.resetTransform();
 
     // --- Draw House ---
-    auto drawHouse = [&](QPainter& painter, const QPointF& screenPos) {
-        painter.save();
-
-        const float scaleFactor = 3.0f;
-        const float width = m_scale * scaleFactor;
-        const float height = m_scale * scaleFactor;
-        const float roofHeight = 0.7f * m_scale * scaleFactor;
+    // The house and vehicle pixmaps are redrawn only when the scale or pixel ratio changes
+    m_sprites.setResolution(m_scale, m_physicsWorld->getVehicle()->spec(), devicePixelRatioF());
 
-        QPointF adjustedPos = screenPos + QPointF(0, -height + m_scale * 0.85f);
-
-        painter.translate(adjustedPos);
-
-        // Draw base (square part)
-        QRectF base(-width / 2, 0, width, height);
-        painter.setBrush(Qt::gray);
-        painter.setPen(Qt::white);
-        painter.drawRect(base);
-
-        // Draw roof (triangle)
-        QPolygonF roof;
-        roof << QPointF(-width / 2 - 15, 0)
-             << QPointF(width / 2 + 15, 0)
-             << QPointF(0, -roofHeight);
-        painter.setBrush(Qt::darkRed);
-        painter.drawPolygon(roof);
-
-        painter.restore();
+    // Houses stand one meter above the road at either end
+    auto houseVisible = [&](const b2Vec2 &anchor) {
+        return anchor.x + HouseHalfWidth >= viewLeft && anchor.x - HouseHalfWidth <= viewRight &&
+               anchor.y + HouseAbove >= viewBottom && anchor.y - HouseBelow <= viewTop;
     };
-
     float startX = 0.0f;
-    float endX = 990.0f;
-    float wallY = -1.0f;
+    float endX = profile.endX();
 
-    QPointF leftHousePos = worldToScreenCamera(b2Vec2(startX, wallY));
-    QPointF rightHousePos = worldToScreenCamera(b2Vec2(endX, wallY));
+    b2Vec2 leftHouse(startX, profile.heightAt(startX) + 1.0f);
+    if (houseVisible(leftHouse)) {
+        m_sprites.drawHouse(painter, worldToScreenCamera(leftHouse));
+    }
 
-    drawHouse(painter, leftHousePos);
-    drawHouse(painter, rightHousePos);
+    // Endless roads have no grandma's house at the end
+    if (!profile.isEndless()) {
+        b2Vec2 rightHouse(endX, profile.heightAt(endX) + 1.0f);
+        if (houseVisible(rightHouse)) {
+            m_sprites.drawHouse(painter, worldToScreenCamera(rightHouse));
+        }
+    }
 
     // --- Draw Vehicle ---
+    // The chassis has fixed rotation, so the body is drawn upright
+    m_sprites.drawCarBody(painter, worldToScreenCamera(chassisState.position));
 
-    // Chassis
-    QPointF chassisScreenPos = worldToScreenCamera(chassis->GetPosition());
-    painter.save();
-    painter.translate(chassisScreenPos);
-    painter.rotate(chassis->GetAngle() * 180.0f / b2_pi);
-    painter.scale(m_scale, m_scale);
-
-    // Car body design
-    QPainterPath CarBody;
-    CarBody.moveTo(-1.2, 0.0);       // rear bottom
-    CarBody.lineTo(-1.2, -0.4);      // rear up
-    CarBody.lineTo(-0.8, -0.8);      // curve to roof
-    CarBody.lineTo(0.4, -0.8);       // roof
-    CarBody.lineTo(0.6, -0.5);       // sloped front
-    CarBody.lineTo(1.2, -0.4);       // bottom front up
-    CarBody.lineTo(1.2, 0.0);        // front bottom
-    CarBody.lineTo(-1.2, 0.0);       // close
-    CarBody.closeSubpath();
-
-    painter.setBrush(QColor(200, 40, 40));  // 진한 빨간색
-    painter.setPen(Qt::NoPen);
-    painter.drawPath(CarBody);
-    painter.restore();
-
-    // Wheels
+    // Wheels are concentric circles, so their rotation does not show
     for (int i = 0; i < 2; ++i) {
-        b2Body *wheel = vehicle->getWheel(i);
-        QPointF wheelScreenPos = worldToScreenCamera(wheel->GetPosition());
-        painter.save();
-        painter.translate(wheelScreenPos);
-        painter.rotate(wheel->GetAngle() * 180.0f / b2_pi);
-        painter.scale(m_scale, m_scale);
-
-        // Outer white tire
-        QRectF outerWheel(-0.3, -0.3, 0.6, 0.6);
-        painter.setBrush(Qt::black);
-        painter.setPen(Qt::NoPen);
-        painter.drawEllipse(outerWheel);
-
-        // Inner white hub
-        QRectF innerWheel(-0.18, -0.18, 0.36, 0.36);
-        painter.setBrush(Qt::gray);
-        painter.drawEllipse(innerWheel);
-
-        // Center dot (larger gray hub center)
-       QRectF centerDot(-0.045, -0.045, 0.09, 0.09);
-        painter.setBrush(Qt::black);
-        painter.drawEllipse(centerDot);
-
-        painter.restore();
+        BodyState wheelState = interpolatedState(snapshot, i + 1, alpha);
+        m_sprites.drawWheel(painter, worldToScreenCamera(wheelState.position));
     }
 
     // --- Draw Plants ---
-    const auto &hazards = m_physicsWorld->getHazards();
-    std::vector<Hazard*> herbsToRender;
-    std::vector<Hazard*> poisonousToRender;
-
-    // First, separate herbs and poisonous plants
-    for (auto hazard : hazards) {
-        if (hazard->type() == "herb") {
-            herbsToRender.push_back(hazard);
-        } else if (hazard->type() == "poisonous") {
-            poisonousToRender.push_back(hazard);
+    // Only the plants in the x range of the view are visited, found by binary search in
+    // the sorted index. Hazards are static bodies, so their current transform is also
+    // their interpolated one. Each plant is a single blit of its cached sprite.
+    updatePlantIndex(snapshot);
+    m_plantSprites.setResolution(m_scale, devicePixelRatioF());
+    auto firstPlant = std::lower_bound(m_plantsByX.begin(), m_plantsByX.end(), viewLeft - PlantExtent,
+                                       [](const b2Vec2 &position, float x) { return position.x < x; });
+    for (auto it = firstPlant; it != m_plantsByX.end() && it->x <= viewRight + PlantExtent; ++it) {
+        b2Vec2 pos = *it;
+        if (pos.y + PlantExtent < viewBottom || pos.y - PlantExtent > viewTop) {
+            continue;
         }
-    }
-
-    // Limit poisonous plants to at most 5
-    if (poisonousToRender.size() > 5) {
-        poisonousToRender.resize(5);
-    }
-
-    // Combine the filtered lists
-    std::vector<Hazard*> hazardsToRender;
-    hazardsToRender.insert(hazardsToRender.end(), herbsToRender.begin(), herbsToRender.end());
-    hazardsToRender.insert(hazardsToRender.end(), poisonousToRender.begin(), poisonousToRender.end());
-
-    // Now draw only the filtered hazards
-    for (auto hazard : hazardsToRender) {
-        b2Body *body = hazard->getBody();
-        b2Vec2 pos = body->GetPosition();
-        float angle = body->GetAngle();
-        QPointF screenPos = worldToScreenCamera(pos);
-
-        painter.save();
-        painter.translate(screenPos);
-        painter.rotate(angle * 180.0f / b2_pi);
-        painter.scale(m_scale, m_scale);
-
-        // Use position-based seed for deterministic randomness
-        std::seed_seq seed{static_cast<int>(pos.x * 1000), static_cast<int>(pos.y * 1000)};
-        std::mt19937 rng(seed);
-        std::uniform_real_distribution<float> greenOffset(0, 80);
-        std::uniform_real_distribution<float> ctrlOffset(-0.25f, 0.25f);
-        std::uniform_real_distribution<float> tipJitter(0.0f, 0.3f);
-
-        // Set pen color and thickness for plant
-        int green = 130 + static_cast<int>(greenOffset(rng));
-        painter.setPen(QPen(QColor(0, green, 0), 0.05));
-
-        // Plant configuration
-        int bladeCount = 13;
-        float baseSpread = 0.1f;
-        float bladeHeight = 1.6f;
-
-        for (int i = -bladeCount / 2; i <= bladeCount / 2; ++i) {
-            float offsetX = i * baseSpread;
-            float ctrlX = offsetX * 0.5f + ctrlOffset(rng);
-            float tipY = bladeHeight + tipJitter(rng);
-
-            QPainterPath blade;
-            blade.moveTo(offsetX, 0.0f);
-            blade.quadTo(ctrlX, tipY * 0.5f, 0.0f, tipY);
-            painter.drawPath(blade);
-        }
-
-        painter.restore();
+        m_plantSprites.draw(painter, worldToScreenCamera(pos), pos);
     }
 
 
@@ -338,35 +245,250 @@ void WorldRenderer::paintEvent(QPaintEvent *event)
                          .arg(m_gameManager->poisonousCollected())
                          .arg(m_gameManager->maxPoisonousAllowed()));
 
+    // Physics quality, which F8 cycles through
+    painter.setPen(Qt::white);
+    painter.drawText(10, yPos += 30,
+                     QString("Physics: %1").arg(QString::fromLatin1(toString(m_physicsWorld->quality()))));
+
     painter.end();
 }
 
-void WorldRenderer::keyPressEvent(QKeyEvent *event)
+void WorldRenderer::updatePlantIndex(const RenderSnapshot &snapshot)
 {
-    Vehicle *vehicle = m_physicsWorld->getVehicle();
+    if (snapshot.hazardVersion == m_plantsByXVersion) {
+        return;
+    }
+
+    // Only positions and kinds are read here; plant names and images stay in the catalog
+    const std::vector<b2Vec2> &hazardPositions = snapshot.hazardPositions;
+    const std::vector<PlantKind> &hazardKinds = snapshot.hazardKinds;
+    m_plantsByX.clear();
+
+    // Every herb is drawn, but at most 5 poisonous plants
+    int poisonousCount = 0;
+    for (size_t i = 0; i < hazardPositions.size(); ++i) {
+        if (hazardKinds[i] == PlantKind::Herb) {
+            m_plantsByX.push_back(hazardPositions[i]);
+        } else if (hazardKinds[i] == PlantKind::Poisonous && poisonousCount < 5) {
+            m_plantsByX.push_back(hazardPositions[i]);
+            poisonousCount++;
+        }
+    }
 
+    std::sort(m_plantsByX.begin(), m_plantsByX.end(), [](const b2Vec2 &a, const b2Vec2 &b) {
+        return a.x < b.x;
+    });
+    m_plantsByXVersion = snapshot.hazardVersion;
+    m_plantSprites.retain(m_plantsByX);
+}
+
+void WorldRenderer::keyPressEvent(QKeyEvent *event)
+{
     switch (event->key()) {
     case Qt::Key_Left:
-        vehicle->applyDriveForce(-60.0f);
+        applyDriveForce(-m_physicsWorld->getVehicle()->spec().driveForce);
         break;
     case Qt::Key_Right:
-        vehicle->applyDriveForce(60.0f);
+        applyDriveForce(m_physicsWorld->getVehicle()->spec().driveForce);
+        break;
+    case Qt::Key_F5:
+        // Quick-save
+        if (!saveGame(quickSavePath())) {
+            qWarning() << "Quick-save failed:" << quickSavePath();
+        }
+        break;
+    case Qt::Key_F9:
+        // Quick-load
+        if (!loadGame(quickSavePath())) {
+            qWarning() << "Quick-load failed:" << quickSavePath();
+        }
+        break;
+    case Qt::Key_F6:
+        // Start or stop recording
+        if (!m_physicsThread->recorder().isRecording()) {
+            startRecording();
+        } else if (!stopRecording(recordingPath())) {
+            qWarning() << "Saving the recording failed:" << recordingPath();
+        }
+        break;
+    case Qt::Key_F7:
+        // Start or stop replaying the last recording
+        if (m_physicsThread->isReplaying()) {
+            stopReplay();
+        } else if (!startReplay(recordingPath())) {
+            qWarning() << "Replay failed:" << recordingPath();
+        }
+        break;
+    case Qt::Key_F8:
+        // Cycle the physics quality: low, default, high, adaptive
+        setPhysicsQuality(static_cast<PhysicsQuality>((static_cast<int>(m_physicsWorld->quality()) + 1)
+                                                      % (static_cast<int>(PhysicsQuality::Adaptive) + 1)));
         break;
     }
 }
 
 void WorldRenderer::keyReleaseEvent(QKeyEvent *event)
 {
-    Vehicle *vehicle = m_physicsWorld->getVehicle();
-
     switch (event->key()) {
     case Qt::Key_Left:
     case Qt::Key_Right:
-        vehicle->applyDriveForce(0.0f); // Reset steering
+        applyDriveForce(0.0f); // Reset steering
         break;
     }
 }
 
+void WorldRenderer::applyDriveForce(float force)
+{
+    // Applied and recorded by the physics thread before its next step
+    m_physicsThread->queueDriveForce(force);
+}
+
+void WorldRenderer::startRecording()
+{
+    // Recordings start from a rebuilt world, the same state simrunner replays them from.
+    // Start recording before play resumes so the first step is in it.
+    resetLevel(m_physicsWorld->seed(), true);
+    m_physicsThread->recorder().start(*m_physicsWorld);
+    startLevelPlay();
+}
+
+bool WorldRenderer::stopRecording(const QString &path)
+{
+    bool wasRunning = m_physicsThread->pause();
+    InputRecorder &recorder = m_physicsThread->recorder();
+    bool written = false;
+    if (recorder.isRecording()) {
+        recorder.stop(*m_physicsWorld);
+        written = recorder.write(path);
+    }
+    if (wasRunning) {
+        m_physicsThread->resume();
+    }
+    return written;
+}
+
+bool WorldRenderer::startReplay(const QString &path)
+{
+    bool wasRunning = m_physicsThread->pause();
+    InputReplay &replay = m_physicsThread->replay();
+    if (!replay.open(path)) {
+        if (wasRunning) {
+            m_physicsThread->resume();
+        }
+        return false;
+    }
+
+    // The game's world is built once, so only recordings of the same kind of level fit
+    const InputRecordingHeader &header = replay.header();
+    if (header.hazardCount != m_physicsWorld->hazardCount() ||
+        header.roadPointCount != m_physicsWorld->getTerrainProfile().vertexCount()) {
+        if (wasRunning) {
+            m_physicsThread->resume();
+        }
+        return false;
+    }
+
+    // Take over driving before play resumes so the first step is replayed too
+    resetLevel(header.seed, true);
+    m_physicsWorld->setQuality(static_cast<PhysicsQuality>(header.quality));
+    replay.begin(*m_physicsWorld);
+    m_physicsThread->setReplaying(true);
+    startLevelPlay();
+    return true;
+}
+
+void WorldRenderer::setPhysicsQuality(PhysicsQuality quality)
+{
+    bool wasRunning = m_physicsThread->pause();
+    m_physicsWorld->setQuality(quality);
+    if (wasRunning) {
+        m_physicsThread->resume();
+    }
+}
+
+void WorldRenderer::stopReplay()
+{
+    bool wasRunning = m_physicsThread->pause();
+    m_physicsThread->setReplaying(false);
+    if (wasRunning) {
+        m_physicsThread->resume();
+    }
+}
+
+bool WorldRenderer::saveGame(const QString &path) const
+{
+    SavedProgress progress{};
+    m_gameManager->saveProgress(progress);
+
+    // The world may only be read while the physics thread is idle
+    bool wasRunning = m_physicsThread->pause();
+    bool written = SaveState::write(path, *m_physicsWorld, progress);
+    if (wasRunning) {
+        m_physicsThread->resume();
+    }
+    return written;
+}
+
+bool WorldRenderer::loadGame(const QString &path)
+{
+    SaveState save;
+    if (!save.open(path)) {
+        return false;
+    }
+
+    // Reject the save before anything is stopped, so a bad file leaves the game as it was.
+    // Validation only reads what is fixed when the world is built, so the physics thread
+    // can keep running meanwhile.
+    const SaveStateHeader &header = save.header();
+    if (!m_physicsWorld->validateState(header.world, save.hazards(), header.hazardCount)) {
+        return false;
+    }
+
+    pauseGame();
+
+    // A save-state starts mid-level, so neither a recording nor a replay can carry on
+    stopReplay();
+    if (m_physicsThread->recorder().isRecording() && !stopRecording(recordingPath())) {
+        qWarning() << "Saving the recording failed:" << recordingPath();
+    }
+
+    // Checked above, so this cannot fail
+    m_physicsWorld->loadState(header.world, save.hazards(), header.hazardCount);
+
+    // Restored hazard bodies may be ones the listener already saw
+    m_contactListener->reset();
+
+    // Nothing to interpolate from yet
+    m_physicsThread->publishSnapshot();
+
+    // Announcing the restored state resumes play for level states
+    m_gameManager->restoreProgress(header.progress);
+    return true;
+}
+
+QString WorldRenderer::quickSavePath()
+{
+    QString directory = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    QDir().mkpath(directory);
+    return directory + "/quicksave.sav";
+}
+
+QString WorldRenderer::recordingPath()
+{
+    QString directory = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    QDir().mkpath(directory);
+    return directory + "/recording.rec";
+}
+
+BodyState WorldRenderer::interpolatedState(const RenderSnapshot &snapshot, int index, float alpha)
+{
+    const BodyState &previous = snapshot.previousVehicle[index];
+    const BodyState &current = snapshot.vehicle[index];
+
+    return {(1.0f - alpha) * previous.position + alpha * current.position,
+            (1.0f - alpha) * previous.angle + alpha * current.angle};
+}
+
 QPointF WorldRenderer::worldToScreen(float x, float y)
 {
     return QPointF(x * m_scale + width() / 2.0f, height() / 2.0f - y * m_scale);
@@ -377,19 +499,39 @@ QPointF WorldRenderer::worldToScreen(const b2Vec2 &position)
     return worldToScreen(position.x, position.y);
 }
 
-void WorldRenderer::resetGame()
+void WorldRenderer::resetGame(unsigned int seed)
+{
+    resetLevel(seed);
+    startLevelPlay();
+}
+
+void WorldRenderer::resetLevel(unsigned int seed, bool rebuild)
 {
     // Pause game first to prevent issues
     pauseGame();
 
-    // Create a brand new physics world to avoid issues with reusing the old one
-    delete m_physicsWorld;
-    m_physicsWorld = new PhysicsWorld(15);
-    m_contactListener = new GameContactListener(m_gameManager, m_physicsWorld);
-    // Set up contact listener again
-    m_physicsWorld->getWorld().SetContactListener(m_contactListener);
+    // A new or restarted level ends any recording or replay of the old one
+    stopReplay();
+    if (m_physicsThread->recorder().isRecording() && !stopRecording(recordingPath())) {
+        qWarning() << "Saving the recording failed:" << recordingPath();
+    }
 
-    connect(m_contactListener, &GameContactListener::plantContact, this, &WorldRenderer::showPlantPopup);
+    // Regenerate the level in place; hazard bodies are reused rather than recreated.
+    // The current seed restores the level's snapshot instead. Recordings need a world
+    // without the old one's history, so they rebuild it from the seed.
+    if (rebuild) {
+        m_physicsWorld->rebuild(seed);
+    } else {
+        m_physicsWorld->reset(seed);
+    }
+    m_contactListener->reset();
+
+    // Nothing to interpolate from yet
+    m_physicsThread->publishSnapshot();
+}
+
+void WorldRenderer::startLevelPlay()
+{
     // Reset game state
     if (m_gameManager) {
         int currentLevel = m_gameManager->currentLevel();
@@ -402,16 +544,23 @@ void WorldRenderer::resetGame()
         }
     }
 
-
     // Resume game
     resumeGame();
 }
 
+void WorldRenderer::restartLevel()
+{
+    resetGame(m_physicsWorld->seed());
+}
+
 void WorldRenderer::resumeGame()
 {
     if (m_timer && !m_timer->isActive()) {
         m_timer->start(16);
     }
+
+    // The physics thread skips the time spent paused by itself
+    m_physicsThread->resume();
 }
 
 void WorldRenderer::pauseGame()
@@ -419,63 +568,45 @@ void WorldRenderer::pauseGame()
     if (m_timer && m_timer->isActive()) {
         m_timer->stop();
     }
+
+    // Returns once the physics thread is idle, so the world is safe to change afterwards
+    m_physicsThread->pause();
 }
 
 void WorldRenderer::updateGameState()
 {
-    // Check if in any playable level state
-    if (m_gameManager->gameState() == Level1 ||
-        m_gameManager->gameState() == Level2 ||
-        m_gameManager->gameState() == Level3) {
-
-        try {
-            // Process physics updates
-            m_physicsWorld->step();
-
-            // Process hazard removals after Step() completes
-            m_physicsWorld->processRemovalQueue();
-
-            // Update game logic
-            m_gameManager->update();
-
-            // Check if vehicle reached the right house (game clear condition)
-            Vehicle *vehicle = m_physicsWorld->getVehicle();
-            b2Vec2 vehiclePos = vehicle->getChassis()->GetPosition();
-
-            // Right house position is at x=990.0f, y=-1.0f
-            const float houseX = 990.0f;
-            const float houseY = -1.0f;
-            const float arrivalThreshold = 5.0f; // Distance threshold for arrival
-
-            // Calculate distance to right house
-            float distance = b2Distance(vehiclePos, b2Vec2(houseX, houseY));
-
-            if (distance <= arrivalThreshold) {
-                if (m_gameManager->isLevelComplete()) {
-                    m_gameManager->gameClear(); // Successfully completed level
-                } else {
-                    m_gameManager->gameOver(); // Reached house but didn't collect all plants
-                }
-            }
-        }
-        catch (...) {
-            // If an exception occurs, safely pause the game
-            pauseGame();
-        }
-    }
+    // Update game logic
+    m_gameManager->update();
 
     // Always request a repaint
     update();
 }
 
-void WorldRenderer::showPlantPopup(Hazard* hazard) {
+void WorldRenderer::handleReachedEnd()
+{
+    // Only a level still in play can end; the signal may arrive after a reset
+    GameState state = m_gameManager->gameState();
+    if (state != Level1 && state != Level2 && state != Level3) {
+        return;
+    }
+
+    if (m_gameManager->isLevelComplete()) {
+        m_gameManager->gameClear(); // Successfully completed level
+    } else {
+        m_gameManager->gameOver(); // Reached house but didn't collect all plants
+    }
+}
+
+void WorldRenderer::showPlantPopup(int plantId) {
+    const PlantData &plant = PlantCatalog::instance().plant(plantId);
+
     QDialog* dialog = new QDialog;
     dialog->setWindowTitle("Plant Found");
 
     QVBoxLayout* layout = new QVBoxLayout(dialog);
 
     // Image (check if it opens correctly)
-    QPixmap image(hazard->imagePath());
+    QPixmap image(plant.imagePath);
     QLabel* imageLabel = new QLabel();
     if (!image.isNull()) {
         image = image.scaled(480, 480, Qt::KeepAspectRatio);
@@ -500,7 +631,7 @@ void WorldRenderer::showPlantPopup(Hazard* hazard) {
     layout->addLayout(buttonLayout);
 
     // Info elements (initially hidden)
-    QLabel* nameLabel = new QLabel(hazard->plantName());
+    QLabel* nameLabel = new QLabel(plant.name);
     nameLabel->setAlignment(Qt::AlignCenter);
     QFont nameFont = nameLabel->font();
     nameFont.setPointSize(16);
@@ -509,17 +640,17 @@ void WorldRenderer::showPlantPopup(Hazard* hazard) {
     nameLabel->hide();
     layout->addWidget(nameLabel);
 
-    QLabel* typeLabel = new QLabel(hazard->type() == "herb" ?
+    QLabel* typeLabel = new QLabel(plant.kind == PlantKind::Herb ?
                                        "This appears to be a beneficial herb!" :
                                        "Warning: This may be poisonous!");
     typeLabel->setAlignment(Qt::AlignCenter);
-    typeLabel->setStyleSheet(hazard->type() == "herb" ?
+    typeLabel->setStyleSheet(plant.kind == PlantKind::Herb ?
                                  "color: green; font-weight: bold;" :
                                  "color: red; font-weight: bold;");
     typeLabel->hide();
     layout->addWidget(typeLabel);
 
-    QLabel* descriptionLabel = new QLabel(hazard->description());
+    QLabel* descriptionLabel = new QLabel(plant.description);
     descriptionLabel->setAlignment(Qt::AlignCenter);
     descriptionLabel->setWordWrap(true);
     descriptionLabel->hide();
@@ -556,8 +687,8 @@ void WorldRenderer::showPlantPopup(Hazard* hazard) {
         if (closePtr) closePtr->show();
 
         // Game effects - track plant collection
-        bool isPoisonous = (hazard->type() == "poisonous");
-        m_gameManager->collectPlant(hazard->plantName(), isPoisonous);
+        bool isPoisonous = (plant.kind == PlantKind::Poisonous);
+        m_gameManager->collectPlant(plant.name, isPoisonous);
 
         // Force a repaint to update the HUD immediately
         update();
@@ -17,6 +17,11 @@
 #include "physicsworld.h"
 #include "gameManager.h"
 #include "gameContactListener.h"
+#include "parallaxbackground.h"
+#include "physicsthread.h"
+#include "plantsprites.h"
+#include "roadgeometry.h"
+#include "staticsprites.h"
 
 /**
  * @brief WorldRenderer class responsible for rendering the game world and handling user input
@@ -27,12 +32,18 @@ class WorldRenderer : public QWidget {
 private:
 
     PhysicsWorld *m_physicsWorld;               // Physics simulation engine
+    PhysicsThread *m_physicsThread;             // Steps m_physicsWorld and publishes render snapshots
     QTimer *m_timer;                            // Timer for rendering at fixed intervals (60 FPS)
     float m_scale;                              // Pixels per meter (used for rendering)
 
     GameManager *m_gameManager;                 // Game state manager
     GameContactListener *m_contactListener;     // Collision event handler
-    QPixmap m_background;                       // Background image
+    ParallaxBackground m_background;            // Background layers, stretched to the widget once per size
+    RoadGeometry m_road;                        // Road fill in world coordinates, built once
+    std::vector<b2Vec2> m_plantsByX;            // Positions of the plants to draw, sorted by x
+    uint64_t m_plantsByXVersion;                // Snapshot hazard version m_plantsByX was built from
+    PlantSprites m_plantSprites;                // Plant drawings rasterised at the current scale
+    StaticSprites m_sprites;                    // House and vehicle drawings, made once per scale
 
 
 public:
@@ -49,9 +60,60 @@ public:
     ~WorldRenderer();
 
     /**
-     * @brief Resets the game to its initial state.
+     * @brief Resets the game to its initial state with a freshly generated level.
+     * @param seed Seed for the level layout; the same seed always gives the same level
      */
-    void resetGame();
+    void resetGame(unsigned int seed = PhysicsWorld::randomSeed());
+
+    /**
+     * @brief Restarts the current level from its snapshot without generating a new one.
+     */
+    void restartLevel();
+
+    /**
+     * @brief Saves the running game, physics and progress, to a save-state file.
+     * @param path File to write
+     * @return True if the file was written
+     */
+    bool saveGame(const QString &path) const;
+
+    /**
+     * @brief Loads a save-state file written by saveGame and continues from it.
+     * @param path File to read
+     * @return True if the save was loaded; the game is left untouched otherwise
+     */
+    bool loadGame(const QString &path);
+
+    /**
+     * @brief Restarts the current level and records every drive input from then on.
+     */
+    void startRecording();
+
+    /**
+     * @brief Ends the current recording and writes it out.
+     * @param path File to write
+     * @return True if the file was written
+     */
+    bool stopRecording(const QString &path);
+
+    /**
+     * @brief Rebuilds the recorded level and drives the vehicle from a recording in real time.
+     *        Keyboard driving is ignored until the replay ends.
+     * @param path Recording written by stopRecording
+     * @return True if the replay started; the game is left untouched otherwise
+     */
+    bool startReplay(const QString &path);
+
+    /**
+     * @brief Ends the replay and hands driving back to the keyboard.
+     */
+    void stopReplay();
+
+    /**
+     * @brief Switches the physics quality profile between steps.
+     * @param quality Quality profile
+     */
+    void setPhysicsQuality(PhysicsQuality quality);
 
     /**
      * @brief Resumes the game timer.
@@ -73,10 +135,17 @@ public:
 public slots:
 
     /**
-     * @brief Updates game state and physics, called on timer tick
+     * @brief Updates game state and repaints, called on timer tick. Physics runs on its own thread.
      */
     void updateGameState();
 
+private slots:
+
+    /**
+     * @brief Ends the level when the physics thread reports the house has been reached
+     */
+    void handleReachedEnd();
+
 protected:
 
     /**
@@ -99,12 +168,59 @@ protected:
 
     /**
      * @brief Shows a plant popup when player contacts a plant
-     * @param plant The plant object contacted
+     * @param plantId Plant catalog ID of the plant contacted
      */
-    void showPlantPopup(Hazard* plant);
+    void showPlantPopup(int plantId);
 
 private:
 
+    /**
+     * @brief Location of the quick-save slot used by F5 and F9.
+     * @return Path of the quick-save file
+     */
+    static QString quickSavePath();
+
+    /**
+     * @brief Location of the recording written by F6 and replayed by F7.
+     * @return Path of the recording file
+     */
+    static QString recordingPath();
+
+    /**
+     * @brief Pauses the game, ends any recording or replay and resets the world to a level.
+     *        The game stays paused until startLevelPlay().
+     * @param seed Seed for the level layout
+     * @param rebuild Rebuild the world from the seed instead of resetting it in place, so
+     *        it starts exactly like a new one
+     */
+    void resetLevel(unsigned int seed, bool rebuild = false);
+
+    /**
+     * @brief Restarts the game manager's current level and resumes play.
+     */
+    void startLevelPlay();
+
+    /**
+     * @brief Queues a drive force for the physics thread, which records it if recording is on.
+     * @param force Force passed to Vehicle::applyDriveForce
+     */
+    void applyDriveForce(float force);
+
+    /**
+     * @brief Rebuilds m_plantsByX if the snapshot's hazards have changed since it was built.
+     * @param snapshot Snapshot about to be drawn
+     */
+    void updatePlantIndex(const RenderSnapshot &snapshot);
+
+    /**
+     * @brief Blends a vehicle body's previous and current transforms in a snapshot.
+     * @param snapshot Snapshot to draw
+     * @param index State index (0 = chassis, 1-2 = wheels)
+     * @param alpha How far the display is between the previous and current step
+     * @return Interpolated state to draw
+     */
+    static BodyState interpolatedState(const RenderSnapshot &snapshot, int index, float alpha);
+
     /**
      * @brief Convert world coordinates to screen coordinates.
      * @param x X coordinate in world space